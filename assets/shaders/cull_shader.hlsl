@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "globals.hlsli"
+#include "shader_interop.h"
+
+HE_PUSH_CONSTANT(CullPushConstants, g_push);
+
+bool is_box_visible(ShaderFrustum frustum, float3 center, float3 extents) {
+    for (uint index = 0; index < 6; ++index) {
+        const float4 plane = frustum.planes[index];
+        if (dot(plane.xyz, center) + plane.w < -dot(abs(plane.xyz), extents)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool is_sphere_visible(ShaderFrustum frustum, float3 center, float radius) {
+    for (uint index = 0; index < 6; ++index) {
+        const float4 plane = frustum.planes[index];
+        if (dot(plane.xyz, center) + plane.w < -radius) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// NOTE: The cone test of meshoptimizer, every triangle of the cluster faces away if the view direction lies within the normal cone
+bool is_cone_visible(float3 camera_position, float3 apex, float3 axis, float cutoff) {
+    return dot(normalize(apex - camera_position), axis) < cutoff;
+}
+
+[numthreads(64, 1, 1)]
+void cs_main(uint3 dispatch_id : SV_DispatchThreadID) {
+    const uint cluster_index = dispatch_id.x;
+    if (cluster_index >= g_push.cluster_count) {
+        return;
+    }
+
+    const ShaderCluster cluster = g_push.get_cluster(cluster_index);
+    const ShaderObject object = g_push.get_object(cluster.object_index);
+
+    const ShaderFrustum frustum = g_push.get_frustum();
+    if (!is_box_visible(frustum, object.bounds_center.xyz, object.bounds_extents.xyz)) {
+        return;
+    }
+
+    const float4x4 transform = object.transform_matrix;
+    const float3 scale = float3(
+        length(mul(transform, float4(1.0, 0.0, 0.0, 0.0)).xyz),
+        length(mul(transform, float4(0.0, 1.0, 0.0, 0.0)).xyz),
+        length(mul(transform, float4(0.0, 0.0, 1.0, 0.0)).xyz));
+    const float max_scale = max(scale.x, max(scale.y, scale.z));
+    const float min_scale = min(scale.x, min(scale.y, scale.z));
+
+    const float3 center = mul(transform, float4(cluster.bounding_sphere.xyz, 1.0)).xyz;
+    if (!is_sphere_visible(frustum, center, cluster.bounding_sphere.w * max_scale)) {
+        return;
+    }
+
+    // NOTE: Non-uniform scales skew the normals away from the cone, so only uniformly scaled clusters are backface culled
+    const float cutoff = cluster.cone_axis.w;
+    if (cutoff < 1.0 && max_scale - min_scale <= max_scale * 0.01) {
+        const float3 apex = mul(transform, float4(cluster.cone_apex.xyz, 1.0)).xyz;
+        const float3 axis = normalize(mul(transform, float4(cluster.cone_axis.xyz, 0.0)).xyz);
+        if (!is_cone_visible(get_camera().position.xyz, apex, axis, cutoff)) {
+            return;
+        }
+    }
+
+    const uint slot = g_push.draw_counts.interlocked_add(object.bucket, 1);
+    const uint draw_index = g_push.get_bucket_offset(object.bucket) + slot;
+
+    ShaderDrawCommand command = (ShaderDrawCommand) 0;
+    command.index_count = cluster.index_count;
+    command.instance_count = 1;
+    command.first_index = cluster.first_index;
+    command.vertex_offset = 0;
+    command.first_instance = draw_index;
+
+    g_push.draw_commands.store<ShaderDrawCommand>(draw_index, command);
+    g_push.visible_objects.store<uint>(draw_index, cluster.object_index);
+}
\ No newline at end of file
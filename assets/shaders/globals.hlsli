@@ -187,6 +187,13 @@ struct RwArrayBuffer {
         RWByteAddressBuffer buffer = DESCRIPTOR_HEAP(RWByteAddressBufferHandle, this.handle.write_index());
         buffer.Store<T>(sizeof(T) * index, value);
     }
+
+    uint interlocked_add(uint index, uint value) {
+        RWByteAddressBuffer buffer = DESCRIPTOR_HEAP(RWByteAddressBufferHandle, this.handle.write_index());
+        uint original_value;
+        buffer.InterlockedAdd(sizeof(uint) * index, value, original_value);
+        return original_value;
+    }
 };
 
 struct Texture {
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "color_space.hlsli"
+#include "globals.hlsli"
+#include "shader_interop.h"
+
+HE_PUSH_CONSTANT(IndirectPushConstants, g_push);
+
+struct VertexOutput {
+    float4 position : SV_POSITION;
+    float3 normal : NORMAL;
+    float3 color : COLOR;
+    float2 uv : TEXCOORD;
+    nointerpolation uint object_index : OBJECT_INDEX;
+};
+
+// NOTE: The culling pass stores the index of the draw in its first instance, SV_InstanceID doesn't include it on every backend
+VertexOutput vs_main(
+  uint vertex_id : SV_VertexID,
+#ifdef HE_VULKAN
+  [[vk::builtin("BaseInstance")]] uint draw_index : BASE_INSTANCE
+#else
+  uint draw_index : SV_InstanceID
+#endif
+) {
+    const ShaderCamera camera = get_camera();
+
+    const uint object_index = g_push.get_visible_object(draw_index);
+    const ShaderObject object = g_push.get_object(object_index);
+
+    const ShaderMaterial material = object.material.load<ShaderMaterial>();
+
+    const ShaderMesh mesh = g_push.get_mesh(object.mesh_id);
+    const float4 position = mesh.get_position(vertex_id);
+    const float3 normal = mesh.get_normal(vertex_id).xyz;
+    const float3 color = mesh.get_color(vertex_id).xyz;
+    const float2 tex_coord = mesh.get_tex_coord(vertex_id).xy;
+
+    VertexOutput output = (VertexOutput) 0;
+    output.position = mul(camera.view_projection, mul(object.transform_matrix, position));
+    output.normal = normal;
+    output.color = color * material.color_factors.xyz;
+    output.uv = tex_coord;
+    output.object_index = object_index;
+    return output;
+}
+
+float4 fs_main(VertexOutput input) : SV_TARGET {
+    const ShaderScene scene = g_push.get_scene();
+
+    const ShaderObject object = g_push.get_object(input.object_index);
+    const ShaderMaterial material = object.material.load<ShaderMaterial>();
+
+    const float light_value = max(dot(input.normal, scene.sunlight_direction.xyz), 0.1);
+
+    const float4 color = float4(input.color, 1.0) * material.color_texture.sample_2d<float4>(material.color_sampler.load(), input.uv);
+    const float3 ambient = color.xyz * scene.ambient_color.xyz;
+
+    if (color.a < 0.1) {
+        discard;
+    }
+
+    return float4(apply_srgb(color.xyz * light_value * scene.sunlight_color.w + ambient), 1.0);
+}
@@ -18,12 +18,15 @@ struct VertexOutput {
 };
 
 VertexOutput vs_main(
-  uint vertex_id : SV_VertexID
+  uint vertex_id : SV_VertexID,
+  uint instance_id : SV_InstanceID
 ) {
     const ShaderCamera camera = get_camera();
 
     const ShaderMaterial material = g_push.get_material();
 
+    const ShaderInstance instance = g_push.get_instance(instance_id);
+
     const ShaderMesh mesh = g_push.get_mesh();
     const float4 position = mesh.get_position(vertex_id);
     const float3 normal = mesh.get_normal(vertex_id).xyz;
@@ -31,7 +34,7 @@ VertexOutput vs_main(
     const float2 tex_coord = mesh.get_tex_coord(vertex_id).xy;
 
     VertexOutput output = (VertexOutput) 0;
-    output.position = mul(camera.view_projection, mul(g_push.transform_matrix, position));
+    output.position = mul(camera.view_projection, mul(instance.transform_matrix, position));
     output.normal = normal;
     output.color = color * material.color_factors.xyz;
     output.uv = tex_coord;
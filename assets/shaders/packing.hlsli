@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef HE_PACKING_HLSLI
+#define HE_PACKING_HLSLI
+
+float2 unpack_unorm2x16(uint value) {
+    return float2(value & 0xffff, value >> 16) / 65535.0;
+}
+
+float2 unpack_snorm2x16(uint value) {
+    const int2 components = int2(value << 16, value) >> 16;
+    return max(float2(components) / 32767.0, -1.0);
+}
+
+float4 unpack_unorm4x8(uint value) {
+    return float4(value & 0xff, (value >> 8) & 0xff, (value >> 16) & 0xff, value >> 24) / 255.0;
+}
+
+float2 unpack_half2x16(uint value) {
+    return float2(f16tof32(value), f16tof32(value >> 16));
+}
+
+// NOTE: Inverse of the octahedral mapping, the lower hemisphere is folded over the diagonals of the square
+float3 decode_octahedral(float2 value) {
+    float3 normal = float3(value, 1.0 - abs(value.x) - abs(value.y));
+    const float fold = saturate(-normal.z);
+    normal.x += normal.x >= 0.0 ? -fold : fold;
+    normal.y += normal.y >= 0.0 ? -fold : fold;
+    return normalize(normal);
+}
+
+#endif // HE_PACKING_HLSLI
\ No newline at end of file
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "globals.hlsli"
+#include "shader_interop.h"
+
+HE_PUSH_CONSTANT(PresentPushConstants, g_push);
+
+struct VertexOutput {
+    float4 position : SV_POSITION;
+};
+
+// NOTE: A single triangle covering the whole screen, the parts outside are clipped
+VertexOutput vs_main(
+  uint vertex_id : SV_VertexID
+) {
+    const float2 uv = float2((vertex_id << 1) & 2, vertex_id & 2);
+
+    VertexOutput output = (VertexOutput) 0;
+    output.position = float4(uv * 2.0 - 1.0, 0.0, 1.0);
+    return output;
+}
+
+float4 fs_main(VertexOutput input) : SV_TARGET {
+    return g_push.get_render_color(uint2(input.position.xy));
+}
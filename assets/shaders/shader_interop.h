@@ -35,6 +35,7 @@
 #    define SAMPLER RESOURCE_HANDLE
 #else
 #    include "globals.hlsli"
+#    include "packing.hlsli"
 
 #    define RESOURCE_HANDLE uint
 #    define SIMPLE_BUFFER SimpleBuffer
@@ -58,6 +59,8 @@ struct ShaderScene
     float4 padding_0;
 };
 
+// NOTE: Positions are unorm16 within the bounds of the mesh, normals octahedral snorm16, colors unorm8 and tex coords half floats.
+//       The streams are pages of the geometry arena shared with other meshes, the indices are relative to the base vertex.
 struct ShaderMesh
 {
     ARRAY_BUFFER positions;
@@ -65,25 +68,35 @@ struct ShaderMesh
     ARRAY_BUFFER colors;
     ARRAY_BUFFER tex_coords;
 
+    uint base_vertex;
+    uint padding_0;
+    uint padding_1;
+    uint padding_2;
+
+    float4 position_offset;
+    float4 position_scale;
+
 #ifndef __cplusplus
     inline float4 get_position(uint index)
     {
-        return positions.load<float4>(index);
+        const uint2 packed_position = positions.load<uint2>(base_vertex + index);
+        const float3 position = float3(unpack_unorm2x16(packed_position.x), unpack_unorm2x16(packed_position.y).x);
+        return float4(position_offset.xyz + position * position_scale.xyz, 1.0);
     }
 
     inline float4 get_normal(uint index)
     {
-        return normals.load<float4>(index);
+        return float4(decode_octahedral(unpack_snorm2x16(normals.load<uint>(base_vertex + index))), 0.0);
     }
 
     inline float4 get_color(uint index)
     {
-        return colors.load<float4>(index);
+        return unpack_unorm4x8(colors.load<uint>(base_vertex + index));
     }
 
     inline float4 get_tex_coord(uint index)
     {
-        return tex_coords.load<float4>(index);
+        return float4(unpack_half2x16(tex_coords.load<uint>(base_vertex + index)), 0.0, 0.0);
     }
 #endif
 };
@@ -103,6 +116,57 @@ struct ShaderMaterial
     uint padding_3;
 };
 
+struct ShaderInstance
+{
+    float4x4 transform_matrix;
+};
+
+// NOTE: One opaque surface of the persistent scene buffer, the bounds are already in world space
+struct ShaderObject
+{
+    float4x4 transform_matrix;
+    float4 bounds_center;
+    float4 bounds_extents;
+
+    uint mesh_id;
+    SIMPLE_BUFFER material;
+    uint first_index;
+    uint index_count;
+
+    uint bucket;
+    uint padding_0;
+    uint padding_1;
+    uint padding_2;
+};
+
+// NOTE: One meshlet of an object, the bounds and the normal cone are in mesh space and transformed by the object while culling
+struct ShaderCluster
+{
+    float4 bounding_sphere; // .w for radius
+    float4 cone_apex;
+    float4 cone_axis; // .w for cutoff
+
+    uint object_index;
+    uint first_index;
+    uint index_count;
+    uint padding_0;
+};
+
+// NOTE: Matches the layout of VkDrawIndexedIndirectCommand
+struct ShaderDrawCommand
+{
+    uint index_count;
+    uint instance_count;
+    uint first_index;
+    int vertex_offset;
+    uint first_instance;
+};
+
+struct ShaderFrustum
+{
+    float4 planes[6];
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // Push Constants
 ////////////////////////////////////////////////////////////////////////////////
@@ -115,13 +179,17 @@ struct ShaderMaterial
 #    endif
 #endif
 
+// NOTE: Every draw renders all instances of one mesh surface and material, the instances are stored contiguously from first_instance
 struct ObjectPushConstants
 {
     SIMPLE_BUFFER scene;
-    SIMPLE_BUFFER mesh;
+    ARRAY_BUFFER meshes;
     SIMPLE_BUFFER material;
+    ARRAY_BUFFER instances;
+    uint first_instance;
+    uint mesh_id;
     uint padding_0;
-    float4x4 transform_matrix;
+    uint padding_1;
 
 #ifndef __cplusplus
     inline ShaderScene get_scene()
@@ -131,13 +199,97 @@ struct ObjectPushConstants
 
     inline ShaderMesh get_mesh()
     {
-        return mesh.load<ShaderMesh>();
+        return meshes.load<ShaderMesh>(mesh_id);
     }
 
     inline ShaderMaterial get_material()
     {
         return material.load<ShaderMaterial>();
     }
+
+    inline ShaderInstance get_instance(uint instance_id)
+    {
+        return instances.load<ShaderInstance>(first_instance + instance_id);
+    }
+#endif
+};
+
+// NOTE: Every visible cluster appends a draw command to the range of the bucket of its object, the draw counts are per bucket
+struct CullPushConstants
+{
+    SIMPLE_BUFFER frustum;
+    ARRAY_BUFFER objects;
+    ARRAY_BUFFER clusters;
+    ARRAY_BUFFER bucket_offsets;
+    RW_ARRAY_BUFFER draw_counts;
+    RW_ARRAY_BUFFER draw_commands;
+    RW_ARRAY_BUFFER visible_objects;
+    uint cluster_count;
+
+#ifndef __cplusplus
+    inline ShaderFrustum get_frustum()
+    {
+        return frustum.load<ShaderFrustum>();
+    }
+
+    inline ShaderObject get_object(uint object_index)
+    {
+        return objects.load<ShaderObject>(object_index);
+    }
+
+    inline ShaderCluster get_cluster(uint cluster_index)
+    {
+        return clusters.load<ShaderCluster>(cluster_index);
+    }
+
+    inline uint get_bucket_offset(uint bucket)
+    {
+        return bucket_offsets.load<uint>(bucket);
+    }
+#endif
+};
+
+// NOTE: The first instance of every indirect draw is the index of its entry in the visible objects
+struct IndirectPushConstants
+{
+    SIMPLE_BUFFER scene;
+    ARRAY_BUFFER meshes;
+    ARRAY_BUFFER objects;
+    ARRAY_BUFFER visible_objects;
+
+#ifndef __cplusplus
+    inline ShaderScene get_scene()
+    {
+        return scene.load<ShaderScene>();
+    }
+
+    inline ShaderMesh get_mesh(uint mesh_id)
+    {
+        return meshes.load<ShaderMesh>(mesh_id);
+    }
+
+    inline ShaderObject get_object(uint object_index)
+    {
+        return objects.load<ShaderObject>(object_index);
+    }
+
+    inline uint get_visible_object(uint draw_index)
+    {
+        return visible_objects.load<uint>(draw_index);
+    }
+#endif
+};
+
+// NOTE: The present pass loads the render target texel by texel, so it doesn't need a sampler
+struct PresentPushConstants
+{
+    TEXTURE render_texture;
+
+#ifndef __cplusplus
+    inline float4 get_render_color(uint2 position)
+    {
+        return render_texture.load_2d<float4>(position);
+    }
 #endif
 };
 
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// NOTE: Based on the dynamic tree of Box2D https://github.com/erincatto/box2d
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "hyper_core/assertion.hpp"
+#include "hyper_core/bounds.hpp"
+
+namespace hyper_engine
+{
+    // NOTE: Leaves store enlarged boxes, so proxies moving within their margin don't touch the tree at all
+    class AabbTree
+    {
+    public:
+        static constexpr int32_t s_null_node = -1;
+        static constexpr float s_fat_margin = 0.1f;
+        static constexpr size_t s_stack_capacity = 256;
+        static constexpr size_t s_batch_size = 4;
+
+    public:
+        int32_t create_proxy(const BoundingBox &box, uint64_t user_data);
+        void destroy_proxy(int32_t proxy);
+        bool move_proxy(int32_t proxy, const BoundingBox &box);
+
+        uint64_t user_data(int32_t proxy) const;
+        const BoundingBox &fat_box(int32_t proxy) const;
+
+        uint32_t proxy_count() const;
+        int32_t height() const;
+
+        // NOTE: The query functions receive the user data of every overlapping proxy and return false to stop the query early
+        template <typename Function>
+        void query(const BoundingBox &box, Function function) const
+        {
+            traverse(
+                [&box](const BoundingBox &node_box)
+                {
+                    return box.intersects(node_box);
+                },
+                function);
+        }
+
+        template <typename Function>
+        void query(const BoundingSphere &sphere, Function function) const
+        {
+            traverse(
+                [&sphere](const BoundingBox &node_box)
+                {
+                    return sphere.intersects(node_box);
+                },
+                function);
+        }
+
+        template <typename Function>
+        void query(const Frustum &frustum, Function function) const
+        {
+            const FrustumPlanes planes = AabbTree::frustum_planes(frustum);
+            traverse(
+                [&planes](const BoundingBox &node_box)
+                {
+                    return AabbTree::intersects(planes, node_box);
+                },
+                function);
+        }
+
+        // NOTE: The function receives the user data and the entry distance of every hit box, hits are not sorted by distance
+        template <typename Function>
+        void ray_cast(const Ray &ray, const float max_distance, Function function) const
+        {
+            if (m_root == s_null_node)
+            {
+                return;
+            }
+
+            std::array<int32_t, s_stack_capacity> stack = {};
+            size_t stack_size = 0;
+            stack[stack_size++] = m_root;
+
+            while (stack_size > 0)
+            {
+                const Node &node = m_nodes[stack[--stack_size]];
+
+                const float distance = ray.intersect(node.box, max_distance);
+                if (distance < 0.0f)
+                {
+                    continue;
+                }
+
+                if (node.is_leaf())
+                {
+                    if (!function(node.user_data, distance))
+                    {
+                        return;
+                    }
+
+                    continue;
+                }
+
+                HE_ASSERT(stack_size + 2 <= stack.size());
+                stack[stack_size++] = node.left;
+                stack[stack_size++] = node.right;
+            }
+        }
+
+        // NOTE: Tests every node against up to four boxes at once, the function receives the index of the query box and the user data
+        template <typename Function>
+        void query_batch(const std::span<const BoundingBox> boxes, Function function) const
+        {
+            for (size_t offset = 0; offset < boxes.size(); offset += s_batch_size)
+            {
+                const size_t count = std::min(s_batch_size, boxes.size() - offset);
+                const BatchBoxes batch = AabbTree::batch_boxes(boxes.subspan(offset, count));
+
+                if (m_root == s_null_node)
+                {
+                    return;
+                }
+
+                std::array<std::pair<int32_t, uint32_t>, s_stack_capacity> stack = {};
+                size_t stack_size = 0;
+                stack[stack_size++] = {m_root, (1u << count) - 1};
+
+                while (stack_size > 0)
+                {
+                    const auto [node_index, parent_mask] = stack[--stack_size];
+                    const Node &node = m_nodes[node_index];
+
+                    const uint32_t mask = parent_mask & AabbTree::overlap_mask(batch, node.box);
+                    if (mask == 0)
+                    {
+                        continue;
+                    }
+
+                    if (node.is_leaf())
+                    {
+                        for (uint32_t lane = 0; lane < count; ++lane)
+                        {
+                            if ((mask & (1u << lane)) != 0)
+                            {
+                                function(static_cast<uint32_t>(offset + lane), node.user_data);
+                            }
+                        }
+
+                        continue;
+                    }
+
+                    HE_ASSERT(stack_size + 2 <= stack.size());
+                    stack[stack_size++] = {node.left, mask};
+                    stack[stack_size++] = {node.right, mask};
+                }
+            }
+        }
+
+    private:
+        struct Node
+        {
+            BoundingBox box;
+            uint64_t user_data = 0;
+            int32_t parent = s_null_node;
+            int32_t left = s_null_node;
+            int32_t right = s_null_node;
+            int32_t height = 0;
+
+            bool is_leaf() const
+            {
+                return left == s_null_node;
+            }
+        };
+
+        // NOTE: Structure of arrays layouts, so one SIMD instruction covers four planes or four query boxes
+        struct FrustumPlanes
+        {
+            alignas(16) std::array<float, 8> normal_x = {};
+            alignas(16) std::array<float, 8> normal_y = {};
+            alignas(16) std::array<float, 8> normal_z = {};
+            alignas(16) std::array<float, 8> distance = {};
+        };
+
+        struct BatchBoxes
+        {
+            alignas(16) std::array<float, s_batch_size> min_x = {};
+            alignas(16) std::array<float, s_batch_size> min_y = {};
+            alignas(16) std::array<float, s_batch_size> min_z = {};
+            alignas(16) std::array<float, s_batch_size> max_x = {};
+            alignas(16) std::array<float, s_batch_size> max_y = {};
+            alignas(16) std::array<float, s_batch_size> max_z = {};
+        };
+
+    private:
+        template <typename Test, typename Function>
+        void traverse(Test test, Function function) const
+        {
+            if (m_root == s_null_node)
+            {
+                return;
+            }
+
+            std::array<int32_t, s_stack_capacity> stack = {};
+            size_t stack_size = 0;
+            stack[stack_size++] = m_root;
+
+            while (stack_size > 0)
+            {
+                const Node &node = m_nodes[stack[--stack_size]];
+                if (!test(node.box))
+                {
+                    continue;
+                }
+
+                if (node.is_leaf())
+                {
+                    if (!function(node.user_data))
+                    {
+                        return;
+                    }
+
+                    continue;
+                }
+
+                HE_ASSERT(stack_size + 2 <= stack.size());
+                stack[stack_size++] = node.left;
+                stack[stack_size++] = node.right;
+            }
+        }
+
+        static FrustumPlanes frustum_planes(const Frustum &frustum);
+        static bool intersects(const FrustumPlanes &planes, const BoundingBox &box);
+
+        static BatchBoxes batch_boxes(std::span<const BoundingBox> boxes);
+        static uint32_t overlap_mask(const BatchBoxes &boxes, const BoundingBox &box);
+
+        int32_t allocate_node();
+        void free_node(int32_t node);
+
+        void insert_leaf(int32_t leaf);
+        void remove_leaf(int32_t leaf);
+
+        int32_t balance(int32_t node);
+        void refit(int32_t node);
+
+    private:
+        std::vector<Node> m_nodes;
+        int32_t m_root = s_null_node;
+        int32_t m_free_list = s_null_node;
+        uint32_t m_proxy_count = 0;
+    };
+} // namespace hyper_engine
\ No newline at end of file
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <utility>
+
+#include "hyper_core/math.hpp"
+
+namespace hyper_engine
+{
+    struct BoundingBox
+    {
+        glm::vec3 min = glm::vec3(std::numeric_limits<float>::max());
+        glm::vec3 max = glm::vec3(std::numeric_limits<float>::lowest());
+
+        bool is_valid() const
+        {
+            return min.x <= max.x && min.y <= max.y && min.z <= max.z;
+        }
+
+        glm::vec3 center() const
+        {
+            return (min + max) * 0.5f;
+        }
+
+        glm::vec3 extents() const
+        {
+            return (max - min) * 0.5f;
+        }
+
+        float surface_area() const
+        {
+            const glm::vec3 size = max - min;
+            return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+        }
+
+        void merge(const glm::vec3 &point)
+        {
+            min = glm::min(min, point);
+            max = glm::max(max, point);
+        }
+
+        void merge(const BoundingBox &other)
+        {
+            min = glm::min(min, other.min);
+            max = glm::max(max, other.max);
+        }
+
+        bool contains(const BoundingBox &other) const
+        {
+            return min.x <= other.min.x && min.y <= other.min.y && min.z <= other.min.z && max.x >= other.max.x && max.y >= other.max.y &&
+                   max.z >= other.max.z;
+        }
+
+        bool intersects(const BoundingBox &other) const
+        {
+            return min.x <= other.max.x && min.y <= other.max.y && min.z <= other.max.z && max.x >= other.min.x && max.y >= other.min.y &&
+                   max.z >= other.min.z;
+        }
+
+        // NOTE: Uses the absolute matrix to transform the extents, which keeps the box tight without transforming all corners
+        BoundingBox transformed(const glm::mat4 &matrix) const
+        {
+            if (!is_valid())
+            {
+                return *this;
+            }
+
+            const glm::vec3 old_center = center();
+            const glm::vec3 old_extents = extents();
+
+            const glm::vec3 new_center = glm::vec3(matrix * glm::vec4(old_center, 1.0f));
+            const glm::vec3 new_extents = glm::abs(glm::vec3(matrix[0])) * old_extents.x + glm::abs(glm::vec3(matrix[1])) * old_extents.y +
+                                          glm::abs(glm::vec3(matrix[2])) * old_extents.z;
+
+            return {
+                .min = new_center - new_extents,
+                .max = new_center + new_extents,
+            };
+        }
+    };
+
+    struct BoundingSphere
+    {
+        glm::vec3 center = {0.0f, 0.0f, 0.0f};
+        float radius = 0.0f;
+
+        bool intersects(const BoundingBox &box) const
+        {
+            const glm::vec3 closest = glm::min(glm::max(center, box.min), box.max);
+            const glm::vec3 offset = closest - center;
+            return glm::dot(offset, offset) <= radius * radius;
+        }
+    };
+
+    struct Ray
+    {
+        glm::vec3 origin = {0.0f, 0.0f, 0.0f};
+        glm::vec3 direction = {0.0f, 0.0f, 1.0f};
+
+        // NOTE: Slab test, returns the entry distance or a negative value if the box is missed
+        float intersect(const BoundingBox &box, const float max_distance) const
+        {
+            float near_distance = 0.0f;
+            float far_distance = max_distance;
+            for (glm::length_t axis = 0; axis < 3; ++axis)
+            {
+                const float inverse_direction = 1.0f / direction[axis];
+                float first = (box.min[axis] - origin[axis]) * inverse_direction;
+                float second = (box.max[axis] - origin[axis]) * inverse_direction;
+                if (first > second)
+                {
+                    std::swap(first, second);
+                }
+
+                near_distance = std::max(near_distance, first);
+                far_distance = std::min(far_distance, second);
+                if (near_distance > far_distance)
+                {
+                    return -1.0f;
+                }
+            }
+
+            return near_distance;
+        }
+    };
+
+    // NOTE: Planes point inwards and are stored as (normal, distance), a point is inside if dot(normal, point) + distance >= 0
+    struct Frustum
+    {
+        std::array<glm::vec4, 6> planes = {};
+
+        static Frustum from_matrix(const glm::mat4 &view_projection)
+        {
+            const glm::vec4 row_x = {view_projection[0][0], view_projection[1][0], view_projection[2][0], view_projection[3][0]};
+            const glm::vec4 row_y = {view_projection[0][1], view_projection[1][1], view_projection[2][1], view_projection[3][1]};
+            const glm::vec4 row_z = {view_projection[0][2], view_projection[1][2], view_projection[2][2], view_projection[3][2]};
+            const glm::vec4 row_w = {view_projection[0][3], view_projection[1][3], view_projection[2][3], view_projection[3][3]};
+
+            // NOTE: The depth range is zero to one, so the near plane is only the z row
+            Frustum frustum = {
+                .planes =
+                    {
+                        row_w + row_x,
+                        row_w - row_x,
+                        row_w + row_y,
+                        row_w - row_y,
+                        row_z,
+                        row_w - row_z,
+                    },
+            };
+
+            for (glm::vec4 &plane : frustum.planes)
+            {
+                plane /= glm::length(glm::vec3(plane));
+            }
+
+            return frustum;
+        }
+
+        bool intersects(const BoundingBox &box) const
+        {
+            const glm::vec3 center = box.center();
+            const glm::vec3 extents = box.extents();
+            for (const glm::vec4 &plane : planes)
+            {
+                const glm::vec3 normal = glm::vec3(plane);
+                if (glm::dot(normal, center) + plane.w < -glm::dot(glm::abs(normal), extents))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        bool intersects(const BoundingSphere &sphere) const
+        {
+            for (const glm::vec4 &plane : planes)
+            {
+                if (glm::dot(glm::vec3(plane), sphere.center) + plane.w < -sphere.radius)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    };
+} // namespace hyper_engine
\ No newline at end of file
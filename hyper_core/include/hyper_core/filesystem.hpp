@@ -6,10 +6,12 @@
 
 #pragma once
 
+#include <span>
 #include <string_view>
 #include <vector>
 
 namespace hyper_engine::filesystem
 {
     std::vector<uint8_t> read_file(std::string_view path);
+    bool write_file(std::string_view path, std::span<const uint8_t> data);
 } // namespace hyper_engine::filesystem
\ No newline at end of file
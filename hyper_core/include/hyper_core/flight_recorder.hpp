@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+
+namespace hyper_engine
+{
+    enum class FramePhase : uint8_t
+    {
+        Events,
+        FixedUpdate,
+        Update,
+        Render,
+        Present,
+        Count,
+    };
+
+    struct FrameRecord
+    {
+        uint64_t frame_index = 0;
+        std::array<float, static_cast<size_t>(FramePhase::Count)> phase_times = {};
+        uint32_t resources_created = 0;
+        uint32_t resources_destroyed = 0;
+        uint32_t pass_count = 0;
+        uint64_t memory_usage = 0;
+        uint64_t memory_budget = 0;
+    };
+
+    struct PassRecord
+    {
+        uint64_t frame_index = 0;
+        std::array<char, 48> label = {};
+    };
+
+    // NOTE: The records are plain data in fixed-size rings, so they can be written out from a signal handler
+    class FlightRecorder
+    {
+    public:
+        static constexpr size_t s_frame_capacity = 128;
+        static constexpr size_t s_pass_capacity = 64;
+        static constexpr const char *s_dump_path = "flight_recorder.log";
+
+    public:
+        FlightRecorder();
+        ~FlightRecorder();
+
+        void begin_frame(uint64_t frame_index);
+        void end_frame();
+
+        void record_phase(FramePhase phase, float milliseconds);
+        void record_pass(std::string_view label);
+        void record_resources_created(uint32_t count);
+        void record_resources_destroyed(uint32_t count);
+        void record_memory(uint64_t usage, uint64_t budget);
+
+        void dump(const char *path) const;
+
+        static FlightRecorder *&get();
+
+        // NOTE: Has to be called on every thread besides the one creating the recorder, otherwise a stack overflow there can't be dumped
+        static void install_signal_stack();
+
+    private:
+        static void install_crash_handlers();
+        static void restore_crash_handlers();
+        static void on_signal(int signal);
+
+    private:
+        std::array<FrameRecord, s_frame_capacity> m_frames = {};
+        std::atomic<uint64_t> m_frame_count = 0;
+        FrameRecord m_current_frame = {};
+
+        std::array<PassRecord, s_pass_capacity> m_passes = {};
+        std::atomic<uint64_t> m_pass_count = 0;
+
+        std::atomic<uint32_t> m_resources_created = 0;
+        std::atomic<uint32_t> m_resources_destroyed = 0;
+    };
+} // namespace hyper_engine
\ No newline at end of file
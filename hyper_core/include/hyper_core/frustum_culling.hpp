@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "hyper_core/bounds.hpp"
+
+namespace hyper_engine
+{
+    // NOTE: Bounding boxes as centers and extents in structure of arrays form, so one SIMD instruction covers four or eight boxes
+    struct BoundingBoxBatch
+    {
+        std::vector<float> center_x;
+        std::vector<float> center_y;
+        std::vector<float> center_z;
+        std::vector<float> extents_x;
+        std::vector<float> extents_y;
+        std::vector<float> extents_z;
+
+        void clear();
+        void reserve(size_t count);
+        void push_back(const BoundingBox &box);
+
+        size_t size() const;
+    };
+
+    // NOTE: Writes one for every box intersecting the frustum and zero for every box outside of it
+    void cull_boxes(const Frustum &frustum, const BoundingBoxBatch &boxes, std::span<uint8_t> visibility);
+} // namespace hyper_engine
\ No newline at end of file
@@ -22,17 +22,31 @@ namespace hyper_engine
         uint32_t group_index = 0;
     };
 
+    // NOTE: Tracks the jobs submitted with it, so a caller can wait for its own jobs instead of every job in the system
+    struct JobContext
+    {
+        std::atomic<uint32_t> pending_count = 0;
+    };
+
     class JobSystem
     {
     public:
         JobSystem();
 
         void execute(const std::function<void()> &job);
+        void execute(JobContext &context, const std::function<void()> &job);
         void dispatch(uint32_t job_count, uint32_t group_size, const std::function<void(DispatchArgs)> &job);
+        void dispatch(JobContext &context, uint32_t job_count, uint32_t group_size, const std::function<void(DispatchArgs)> &job);
 
         bool is_busy() const;
+        static bool is_busy(const JobContext &context);
 
         void wait_for_idle();
+        void wait(const JobContext &context);
+
+        // NOTE: Includes the threads outside the job system, which all share the index zero
+        uint32_t thread_count() const;
+        static uint32_t thread_index();
 
         static JobSystem *&get();
 
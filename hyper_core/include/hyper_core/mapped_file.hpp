@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace hyper_engine
+{
+    // NOTE: Read-only view of a whole file, the pages are loaded lazily by the operating system
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        explicit MappedFile(std::string_view path);
+        ~MappedFile();
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        MappedFile(MappedFile &&other) noexcept;
+        MappedFile &operator=(MappedFile &&other) noexcept;
+
+        bool is_valid() const;
+
+        std::span<const uint8_t> data() const;
+        size_t size() const;
+
+    private:
+        void unmap();
+
+    private:
+        const uint8_t *m_data = nullptr;
+        size_t m_size = 0;
+#if HE_WINDOWS
+        void *m_file = nullptr;
+        void *m_mapping = nullptr;
+#endif
+    };
+} // namespace hyper_engine
\ No newline at end of file
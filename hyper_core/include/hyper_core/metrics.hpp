@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include "hyper_core/own_ptr.hpp"
+
+namespace hyper_engine
+{
+    // NOTE: Every update only touches the shard of the calling thread, the shards are summed up when reading
+    static constexpr size_t g_metric_shard_count = 16;
+
+    class Counter
+    {
+    public:
+        void add(uint64_t value = 1);
+
+        uint64_t value() const;
+
+    private:
+        struct alignas(64) Shard
+        {
+            std::atomic<uint64_t> value = 0;
+        };
+
+        std::array<Shard, g_metric_shard_count> m_shards;
+    };
+
+    class Gauge
+    {
+    public:
+        void set(int64_t value);
+        void add(int64_t value);
+
+        int64_t value() const;
+
+    private:
+        std::atomic<int64_t> m_value = 0;
+    };
+
+    struct HistogramSnapshot
+    {
+        static constexpr size_t s_bucket_count = 32;
+
+        uint64_t count = 0;
+        uint64_t sum = 0;
+        uint64_t max = 0;
+
+        // NOTE: Bucket n counts values in the range [2^(n-1), 2^n), the last bucket is unbounded
+        std::array<uint64_t, s_bucket_count> buckets = {};
+
+        uint64_t percentile(double fraction) const;
+    };
+
+    class Histogram
+    {
+    public:
+        void record(uint64_t value);
+
+        HistogramSnapshot snapshot() const;
+
+    private:
+        struct alignas(64) Shard
+        {
+            std::atomic<uint64_t> count = 0;
+            std::atomic<uint64_t> sum = 0;
+            std::atomic<uint64_t> max = 0;
+            std::array<std::atomic<uint64_t>, HistogramSnapshot::s_bucket_count> buckets = {};
+        };
+
+        std::array<Shard, g_metric_shard_count> m_shards;
+    };
+
+    class MetricsRegistry
+    {
+    public:
+        // NOTE: The returned references stay valid for the lifetime of the registry, so they can be cached by the caller
+        Counter &counter(std::string_view name);
+        Gauge &gauge(std::string_view name);
+        Histogram &histogram(std::string_view name);
+
+        void set_export(std::string_view path, std::chrono::milliseconds interval);
+        void update();
+        void write(std::ostream &stream) const;
+
+        static MetricsRegistry *&get();
+
+    private:
+        mutable std::mutex m_mutex;
+        std::map<std::string, OwnPtr<Counter>, std::less<>> m_counters;
+        std::map<std::string, OwnPtr<Gauge>, std::less<>> m_gauges;
+        std::map<std::string, OwnPtr<Histogram>, std::less<>> m_histograms;
+
+        std::ofstream m_export_file;
+        std::chrono::milliseconds m_export_interval = std::chrono::milliseconds(1000);
+        std::chrono::steady_clock::time_point m_start_time = std::chrono::steady_clock::now();
+        std::chrono::steady_clock::time_point m_last_export_time = std::chrono::steady_clock::now();
+    };
+} // namespace hyper_engine
\ No newline at end of file
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// NOTE: Based on the intrusive MPSC queue of https://www.1024cores.net/home/lock-free-algorithms/queues/intrusive-mpsc-node-based-queue
+
+#pragma once
+
+#include <atomic>
+#include <concepts>
+
+namespace hyper_engine
+{
+    // NOTE: Embedded into the queued values, so pushing doesn't allocate
+    struct MpscNode
+    {
+        std::atomic<MpscNode *> next = nullptr;
+    };
+
+    // NOTE: Any thread may push, but only a single thread may pop. The queue doesn't own the values, whoever pops a value owns it.
+    template <typename T>
+        requires std::derived_from<T, MpscNode>
+    class MpscQueue
+    {
+    public:
+        MpscQueue()
+            : m_head(&m_stub)
+            , m_tail(&m_stub)
+        {
+        }
+
+        MpscQueue(const MpscQueue &) = delete;
+        MpscQueue &operator=(const MpscQueue &) = delete;
+
+        void push(T *value)
+        {
+            push_node(value);
+        }
+
+        // NOTE: Returns nullptr if the queue is empty or a push is still linking its node
+        T *pop()
+        {
+            MpscNode *tail = m_tail;
+            MpscNode *next = tail->next.load(std::memory_order_acquire);
+
+            // NOTE: The stub separates the consumer from the producers while the queue runs empty, it is skipped when popping
+            if (tail == &m_stub)
+            {
+                if (next == nullptr)
+                {
+                    return nullptr;
+                }
+
+                m_tail = next;
+                tail = next;
+                next = next->next.load(std::memory_order_acquire);
+            }
+
+            if (next != nullptr)
+            {
+                m_tail = next;
+                return static_cast<T *>(tail);
+            }
+
+            if (tail != m_head.load(std::memory_order_acquire))
+            {
+                return nullptr;
+            }
+
+            // NOTE: The tail is the last node, the stub is queued behind it so the tail can be handed out
+            push_node(&m_stub);
+
+            next = tail->next.load(std::memory_order_acquire);
+            if (next != nullptr)
+            {
+                m_tail = next;
+                return static_cast<T *>(tail);
+            }
+
+            return nullptr;
+        }
+
+    private:
+        void push_node(MpscNode *node)
+        {
+            node->next.store(nullptr, std::memory_order_relaxed);
+
+            MpscNode *previous = m_head.exchange(node, std::memory_order_acq_rel);
+            previous->next.store(node, std::memory_order_release);
+        }
+
+    private:
+        MpscNode m_stub;
+        std::atomic<MpscNode *> m_head;
+        MpscNode *m_tail = nullptr;
+    };
+} // namespace hyper_engine
\ No newline at end of file
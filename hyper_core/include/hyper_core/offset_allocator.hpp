@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <map>
+
+namespace hyper_engine
+{
+    // NOTE: Sub-allocates ranges of a fixed size space. The free ranges are kept sorted by offset, so freeing a range merges it with
+    //       its free neighbours and the space doesn't fragment into ranges too small to be reused.
+    class OffsetAllocator
+    {
+    public:
+        static constexpr uint64_t s_invalid_offset = std::numeric_limits<uint64_t>::max();
+
+    public:
+        explicit OffsetAllocator(uint64_t size);
+
+        // NOTE: First fit, returns the invalid offset if no free range is large enough
+        uint64_t allocate(uint64_t size);
+        void free(uint64_t offset, uint64_t size);
+
+        uint64_t size() const;
+        uint64_t free_size() const;
+        uint32_t free_range_count() const;
+
+    private:
+        uint64_t m_size = 0;
+        uint64_t m_free_size = 0;
+        std::map<uint64_t, uint64_t> m_free_ranges;
+    };
+} // namespace hyper_engine
\ No newline at end of file
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+namespace hyper_engine
+{
+    struct SortEntry
+    {
+        uint64_t key = 0;
+        uint32_t value = 0;
+    };
+
+    // NOTE: Stable least significant digit radix sort over 8 bit digits. Digits shared by every key are skipped, so keys using only a
+    //       few of their bits don't pay for all eight passes. The scratch span needs at least as many entries as the sorted one.
+    void radix_sort(std::span<SortEntry> entries, std::span<SortEntry> scratch);
+} // namespace hyper_engine
\ No newline at end of file
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#    include <xmmintrin.h>
+#    define HE_SIMD_SSE 1
+#else
+#    define HE_SIMD_SSE 0
+#endif
+
+// NOTE: The AVX2 paths are compiled for every x86-64 build and selected at runtime, as the targets aren't built with AVX2 enabled.
+//       Functions using them have to be marked with HE_TARGET_AVX2 and may only be called if cpu_supports_avx2 returned true.
+#if defined(__x86_64__) || defined(_M_X64)
+#    include <immintrin.h>
+#    define HE_SIMD_AVX2 1
+#    if defined(_MSC_VER) && !defined(__clang__)
+#        include <intrin.h>
+#        define HE_TARGET_AVX2
+#    else
+#        define HE_TARGET_AVX2 __attribute__((target("avx2")))
+#    endif
+#else
+#    define HE_SIMD_AVX2 0
+#    define HE_TARGET_AVX2
+#endif
+
+#if defined(__ARM_NEON) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define HE_SIMD_NEON 1
+#else
+#    define HE_SIMD_NEON 0
+#endif
+
+namespace hyper_engine
+{
+    inline bool cpu_supports_avx2()
+    {
+#if HE_SIMD_AVX2 && defined(__AVX2__)
+        return true;
+#elif HE_SIMD_AVX2 && defined(_MSC_VER) && !defined(__clang__)
+        // NOTE: Besides the instruction set, the operating system has to save the upper halves of the registers
+        int registers[4] = {};
+        __cpuid(registers, 1);
+        const bool os_saves_registers = (registers[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+        if (!os_saves_registers)
+        {
+            return false;
+        }
+
+        __cpuidex(registers, 7, 0);
+        return (registers[1] & (1 << 5)) != 0;
+#elif HE_SIMD_AVX2
+        return __builtin_cpu_supports("avx2");
+#else
+        return false;
+#endif
+    }
+} // namespace hyper_engine
\ No newline at end of file
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+namespace hyper_engine
+{
+    // NOTE: Name as spelled by the compiler, which differs in namespaces, elaborated type specifiers and spacing
+    template <typename T>
+    constexpr std::string_view raw_type_name()
+    {
+#if defined(__clang__) || defined(__GNUC__)
+        constexpr std::string_view function_name = __PRETTY_FUNCTION__;
+        constexpr std::string_view prefix = "T = ";
+        constexpr std::string_view suffix = "]";
+#elif defined(_MSC_VER)
+        constexpr std::string_view function_name = __FUNCSIG__;
+        constexpr std::string_view prefix = "raw_type_name<";
+        constexpr std::string_view suffix = ">(void)";
+#else
+#    error "Unsupported compiler"
+#endif
+
+        constexpr size_t start = function_name.find(prefix) + prefix.size();
+        constexpr size_t end = function_name.rfind(suffix);
+        std::string_view name = function_name.substr(start, end - start);
+
+        // NOTE: GCC appends the deduced template arguments of the enclosing scope after a semicolon
+        if (const size_t separator = name.find(';'); separator != std::string_view::npos)
+        {
+            name = name.substr(0, separator);
+        }
+
+        return name;
+    }
+
+    constexpr bool is_identifier_character(const char character)
+    {
+        return (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') || (character >= '0' && character <= '9') ||
+               character == '_';
+    }
+
+    // NOTE: Strips the engine namespace, which GCC omits for types of the enclosing namespace, and the elaborated type specifiers of MSVC
+    //       from every identifier of the name, including template arguments. Spaces are only kept between two identifiers.
+    //       Returns the length of the written name, which is never longer than the input.
+    constexpr size_t normalize_type_name(const std::string_view name, char *output)
+    {
+        constexpr std::array<std::string_view, 4> stripped_prefixes = {"hyper_engine::", "class ", "struct ", "enum "};
+
+        size_t length = 0;
+        size_t index = 0;
+        while (index < name.size())
+        {
+            const bool identifier_start = index == 0 || (!is_identifier_character(name[index - 1]) && name[index - 1] != ':');
+            if (identifier_start)
+            {
+                bool stripped = false;
+                for (const std::string_view prefix : stripped_prefixes)
+                {
+                    if (name.substr(index).starts_with(prefix))
+                    {
+                        index += prefix.size();
+                        stripped = true;
+                        break;
+                    }
+                }
+
+                if (stripped)
+                {
+                    continue;
+                }
+            }
+
+            const char character = name[index];
+            index += 1;
+
+            if (character == ' ')
+            {
+                const bool previous_identifier = length > 0 && is_identifier_character(output[length - 1]);
+                const bool next_identifier = index < name.size() && is_identifier_character(name[index]);
+                if (!previous_identifier || !next_identifier)
+                {
+                    continue;
+                }
+            }
+
+            output[length] = character;
+            length += 1;
+        }
+
+        return length;
+    }
+
+    template <typename T>
+    struct TypeNameStorage
+    {
+        static constexpr std::string_view s_raw_name = raw_type_name<T>();
+        static constexpr std::array<char, s_raw_name.size() + 1> s_name = []
+        {
+            std::array<char, s_raw_name.size() + 1> name = {};
+            normalize_type_name(s_raw_name, name.data());
+            return name;
+        }();
+    };
+
+    // NOTE: Equal on every compiler for the types of the engine and their template arguments. Default template arguments are the
+    //       exception, MSVC spells them out while GCC and Clang omit them, so class templates with defaulted parameters differ.
+    template <typename T>
+    constexpr std::string_view type_name()
+    {
+        return std::string_view(TypeNameStorage<T>::s_name.data());
+    }
+} // namespace hyper_engine
\ No newline at end of file
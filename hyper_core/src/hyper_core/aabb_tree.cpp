@@ -0,0 +1,423 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_core/aabb_tree.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "hyper_core/simd.hpp"
+
+namespace hyper_engine
+{
+    static BoundingBox merged(const BoundingBox &lhs, const BoundingBox &rhs)
+    {
+        BoundingBox box = lhs;
+        box.merge(rhs);
+        return box;
+    }
+
+    int32_t AabbTree::create_proxy(const BoundingBox &box, const uint64_t user_data)
+    {
+        const int32_t proxy = allocate_node();
+
+        Node &node = m_nodes[proxy];
+        node.box = {
+            .min = box.min - glm::vec3(s_fat_margin),
+            .max = box.max + glm::vec3(s_fat_margin),
+        };
+        node.user_data = user_data;
+        node.height = 0;
+
+        insert_leaf(proxy);
+        m_proxy_count += 1;
+
+        return proxy;
+    }
+
+    void AabbTree::destroy_proxy(const int32_t proxy)
+    {
+        HE_ASSERT(proxy >= 0 && static_cast<size_t>(proxy) < m_nodes.size());
+        HE_ASSERT(m_nodes[proxy].is_leaf());
+
+        remove_leaf(proxy);
+        free_node(proxy);
+        m_proxy_count -= 1;
+    }
+
+    bool AabbTree::move_proxy(const int32_t proxy, const BoundingBox &box)
+    {
+        HE_ASSERT(proxy >= 0 && static_cast<size_t>(proxy) < m_nodes.size());
+        HE_ASSERT(m_nodes[proxy].is_leaf());
+
+        if (m_nodes[proxy].box.contains(box))
+        {
+            return false;
+        }
+
+        remove_leaf(proxy);
+
+        m_nodes[proxy].box = {
+            .min = box.min - glm::vec3(s_fat_margin),
+            .max = box.max + glm::vec3(s_fat_margin),
+        };
+
+        insert_leaf(proxy);
+
+        return true;
+    }
+
+    uint64_t AabbTree::user_data(const int32_t proxy) const
+    {
+        HE_ASSERT(proxy >= 0 && static_cast<size_t>(proxy) < m_nodes.size());
+
+        return m_nodes[proxy].user_data;
+    }
+
+    const BoundingBox &AabbTree::fat_box(const int32_t proxy) const
+    {
+        HE_ASSERT(proxy >= 0 && static_cast<size_t>(proxy) < m_nodes.size());
+
+        return m_nodes[proxy].box;
+    }
+
+    uint32_t AabbTree::proxy_count() const
+    {
+        return m_proxy_count;
+    }
+
+    int32_t AabbTree::height() const
+    {
+        return m_root == s_null_node ? 0 : m_nodes[m_root].height;
+    }
+
+    AabbTree::FrustumPlanes AabbTree::frustum_planes(const Frustum &frustum)
+    {
+        FrustumPlanes planes = {};
+
+        // NOTE: The two padding planes have a zero normal and a positive distance, so they never reject anything
+        planes.distance.fill(1.0f);
+        for (size_t index = 0; index < frustum.planes.size(); ++index)
+        {
+            planes.normal_x[index] = frustum.planes[index].x;
+            planes.normal_y[index] = frustum.planes[index].y;
+            planes.normal_z[index] = frustum.planes[index].z;
+            planes.distance[index] = frustum.planes[index].w;
+        }
+
+        return planes;
+    }
+
+    bool AabbTree::intersects(const FrustumPlanes &planes, const BoundingBox &box)
+    {
+        const glm::vec3 center = box.center();
+        const glm::vec3 extents = box.extents();
+
+#if HE_SIMD_SSE
+        const __m128 sign_mask = _mm_set1_ps(-0.0f);
+
+        const __m128 center_x = _mm_set1_ps(center.x);
+        const __m128 center_y = _mm_set1_ps(center.y);
+        const __m128 center_z = _mm_set1_ps(center.z);
+        const __m128 extents_x = _mm_set1_ps(extents.x);
+        const __m128 extents_y = _mm_set1_ps(extents.y);
+        const __m128 extents_z = _mm_set1_ps(extents.z);
+
+        for (size_t offset = 0; offset < planes.distance.size(); offset += 4)
+        {
+            const __m128 normal_x = _mm_load_ps(&planes.normal_x[offset]);
+            const __m128 normal_y = _mm_load_ps(&planes.normal_y[offset]);
+            const __m128 normal_z = _mm_load_ps(&planes.normal_z[offset]);
+
+            __m128 distance = _mm_load_ps(&planes.distance[offset]);
+            distance = _mm_add_ps(distance, _mm_mul_ps(normal_x, center_x));
+            distance = _mm_add_ps(distance, _mm_mul_ps(normal_y, center_y));
+            distance = _mm_add_ps(distance, _mm_mul_ps(normal_z, center_z));
+
+            __m128 radius = _mm_mul_ps(_mm_andnot_ps(sign_mask, normal_x), extents_x);
+            radius = _mm_add_ps(radius, _mm_mul_ps(_mm_andnot_ps(sign_mask, normal_y), extents_y));
+            radius = _mm_add_ps(radius, _mm_mul_ps(_mm_andnot_ps(sign_mask, normal_z), extents_z));
+
+            if (_mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(distance, radius), _mm_setzero_ps())) != 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+#else
+        for (size_t index = 0; index < planes.distance.size(); ++index)
+        {
+            const float distance =
+                planes.normal_x[index] * center.x + planes.normal_y[index] * center.y + planes.normal_z[index] * center.z + planes.distance[index];
+            const float radius = std::abs(planes.normal_x[index]) * extents.x + std::abs(planes.normal_y[index]) * extents.y +
+                                 std::abs(planes.normal_z[index]) * extents.z;
+            if (distance + radius < 0.0f)
+            {
+                return false;
+            }
+        }
+
+        return true;
+#endif
+    }
+
+    AabbTree::BatchBoxes AabbTree::batch_boxes(const std::span<const BoundingBox> boxes)
+    {
+        HE_ASSERT(boxes.size() <= s_batch_size);
+
+        // NOTE: Unused lanes hold inverted boxes, which never overlap anything
+        BatchBoxes batch = {};
+        batch.min_x.fill(std::numeric_limits<float>::max());
+        batch.min_y.fill(std::numeric_limits<float>::max());
+        batch.min_z.fill(std::numeric_limits<float>::max());
+        batch.max_x.fill(std::numeric_limits<float>::lowest());
+        batch.max_y.fill(std::numeric_limits<float>::lowest());
+        batch.max_z.fill(std::numeric_limits<float>::lowest());
+
+        for (size_t index = 0; index < boxes.size(); ++index)
+        {
+            batch.min_x[index] = boxes[index].min.x;
+            batch.min_y[index] = boxes[index].min.y;
+            batch.min_z[index] = boxes[index].min.z;
+            batch.max_x[index] = boxes[index].max.x;
+            batch.max_y[index] = boxes[index].max.y;
+            batch.max_z[index] = boxes[index].max.z;
+        }
+
+        return batch;
+    }
+
+    uint32_t AabbTree::overlap_mask(const BatchBoxes &boxes, const BoundingBox &box)
+    {
+#if HE_SIMD_SSE
+        __m128 overlap = _mm_cmple_ps(_mm_load_ps(boxes.min_x.data()), _mm_set1_ps(box.max.x));
+        overlap = _mm_and_ps(overlap, _mm_cmple_ps(_mm_load_ps(boxes.min_y.data()), _mm_set1_ps(box.max.y)));
+        overlap = _mm_and_ps(overlap, _mm_cmple_ps(_mm_load_ps(boxes.min_z.data()), _mm_set1_ps(box.max.z)));
+        overlap = _mm_and_ps(overlap, _mm_cmpge_ps(_mm_load_ps(boxes.max_x.data()), _mm_set1_ps(box.min.x)));
+        overlap = _mm_and_ps(overlap, _mm_cmpge_ps(_mm_load_ps(boxes.max_y.data()), _mm_set1_ps(box.min.y)));
+        overlap = _mm_and_ps(overlap, _mm_cmpge_ps(_mm_load_ps(boxes.max_z.data()), _mm_set1_ps(box.min.z)));
+
+        return static_cast<uint32_t>(_mm_movemask_ps(overlap));
+#else
+        uint32_t mask = 0;
+        for (size_t lane = 0; lane < s_batch_size; ++lane)
+        {
+            const bool overlaps = boxes.min_x[lane] <= box.max.x && boxes.min_y[lane] <= box.max.y && boxes.min_z[lane] <= box.max.z &&
+                                  boxes.max_x[lane] >= box.min.x && boxes.max_y[lane] >= box.min.y && boxes.max_z[lane] >= box.min.z;
+            mask |= static_cast<uint32_t>(overlaps) << lane;
+        }
+
+        return mask;
+#endif
+    }
+
+    int32_t AabbTree::allocate_node()
+    {
+        if (m_free_list == s_null_node)
+        {
+            m_nodes.emplace_back();
+            return static_cast<int32_t>(m_nodes.size() - 1);
+        }
+
+        const int32_t node = m_free_list;
+        m_free_list = m_nodes[node].parent;
+        m_nodes[node] = {};
+
+        return node;
+    }
+
+    void AabbTree::free_node(const int32_t node)
+    {
+        // NOTE: Free nodes are linked through their parent index
+        m_nodes[node] = {};
+        m_nodes[node].parent = m_free_list;
+        m_nodes[node].height = -1;
+        m_free_list = node;
+    }
+
+    void AabbTree::insert_leaf(const int32_t leaf)
+    {
+        if (m_root == s_null_node)
+        {
+            m_root = leaf;
+            m_nodes[leaf].parent = s_null_node;
+            return;
+        }
+
+        // NOTE: Descends towards the sibling with the lowest surface area cost
+        const BoundingBox leaf_box = m_nodes[leaf].box;
+        int32_t index = m_root;
+        while (!m_nodes[index].is_leaf())
+        {
+            const Node &node = m_nodes[index];
+
+            const float area = node.box.surface_area();
+            const float combined_area = merged(node.box, leaf_box).surface_area();
+
+            const float cost = 2.0f * combined_area;
+            const float inheritance_cost = 2.0f * (combined_area - area);
+
+            const auto child_cost = [this, &leaf_box, inheritance_cost](const int32_t child)
+            {
+                const Node &child_node = m_nodes[child];
+                const float child_area = merged(child_node.box, leaf_box).surface_area();
+                return child_node.is_leaf() ? child_area + inheritance_cost : child_area - child_node.box.surface_area() + inheritance_cost;
+            };
+
+            const float left_cost = child_cost(node.left);
+            const float right_cost = child_cost(node.right);
+            if (cost < left_cost && cost < right_cost)
+            {
+                break;
+            }
+
+            index = left_cost < right_cost ? node.left : node.right;
+        }
+
+        const int32_t sibling = index;
+        const int32_t old_parent = m_nodes[sibling].parent;
+        const int32_t new_parent = allocate_node();
+
+        m_nodes[new_parent].parent = old_parent;
+        m_nodes[new_parent].box = merged(leaf_box, m_nodes[sibling].box);
+        m_nodes[new_parent].height = m_nodes[sibling].height + 1;
+        m_nodes[new_parent].left = sibling;
+        m_nodes[new_parent].right = leaf;
+        m_nodes[sibling].parent = new_parent;
+        m_nodes[leaf].parent = new_parent;
+
+        if (old_parent == s_null_node)
+        {
+            m_root = new_parent;
+        }
+        else if (m_nodes[old_parent].left == sibling)
+        {
+            m_nodes[old_parent].left = new_parent;
+        }
+        else
+        {
+            m_nodes[old_parent].right = new_parent;
+        }
+
+        refit(m_nodes[leaf].parent);
+    }
+
+    void AabbTree::remove_leaf(const int32_t leaf)
+    {
+        if (leaf == m_root)
+        {
+            m_root = s_null_node;
+            return;
+        }
+
+        const int32_t parent = m_nodes[leaf].parent;
+        const int32_t grand_parent = m_nodes[parent].parent;
+        const int32_t sibling = m_nodes[parent].left == leaf ? m_nodes[parent].right : m_nodes[parent].left;
+
+        if (grand_parent == s_null_node)
+        {
+            m_root = sibling;
+            m_nodes[sibling].parent = s_null_node;
+            free_node(parent);
+            return;
+        }
+
+        if (m_nodes[grand_parent].left == parent)
+        {
+            m_nodes[grand_parent].left = sibling;
+        }
+        else
+        {
+            m_nodes[grand_parent].right = sibling;
+        }
+
+        m_nodes[sibling].parent = grand_parent;
+        free_node(parent);
+
+        refit(grand_parent);
+    }
+
+    // NOTE: Rotates the higher grandchild up if the subtrees of the node are imbalanced, returns the new root of the subtree
+    int32_t AabbTree::balance(const int32_t a)
+    {
+        if (m_nodes[a].is_leaf() || m_nodes[a].height < 2)
+        {
+            return a;
+        }
+
+        const int32_t b = m_nodes[a].left;
+        const int32_t c = m_nodes[a].right;
+        const int32_t difference = m_nodes[c].height - m_nodes[b].height;
+        if (difference >= -1 && difference <= 1)
+        {
+            return a;
+        }
+
+        // NOTE: Rotates the higher child `up` into the place of the node
+        const int32_t up = difference > 1 ? c : b;
+        const int32_t other = difference > 1 ? b : c;
+        const int32_t first = m_nodes[up].left;
+        const int32_t second = m_nodes[up].right;
+
+        m_nodes[up].left = a;
+        m_nodes[up].parent = m_nodes[a].parent;
+        m_nodes[a].parent = up;
+
+        if (m_nodes[up].parent == s_null_node)
+        {
+            m_root = up;
+        }
+        else if (m_nodes[m_nodes[up].parent].left == a)
+        {
+            m_nodes[m_nodes[up].parent].left = up;
+        }
+        else
+        {
+            m_nodes[m_nodes[up].parent].right = up;
+        }
+
+        // NOTE: The higher grandchild stays below `up`, the lower one replaces `up` below the node
+        const bool first_higher = m_nodes[first].height > m_nodes[second].height;
+        const int32_t kept = first_higher ? first : second;
+        const int32_t moved = first_higher ? second : first;
+
+        m_nodes[up].right = kept;
+        if (difference > 1)
+        {
+            m_nodes[a].right = moved;
+        }
+        else
+        {
+            m_nodes[a].left = moved;
+        }
+        m_nodes[moved].parent = a;
+
+        m_nodes[a].box = merged(m_nodes[other].box, m_nodes[moved].box);
+        m_nodes[a].height = 1 + std::max(m_nodes[other].height, m_nodes[moved].height);
+
+        m_nodes[up].box = merged(m_nodes[a].box, m_nodes[kept].box);
+        m_nodes[up].height = 1 + std::max(m_nodes[a].height, m_nodes[kept].height);
+
+        return up;
+    }
+
+    void AabbTree::refit(int32_t node)
+    {
+        while (node != s_null_node)
+        {
+            node = balance(node);
+
+            const int32_t left = m_nodes[node].left;
+            const int32_t right = m_nodes[node].right;
+
+            m_nodes[node].height = 1 + std::max(m_nodes[left].height, m_nodes[right].height);
+            m_nodes[node].box = merged(m_nodes[left].box, m_nodes[right].box);
+
+            node = m_nodes[node].parent;
+        }
+    }
+} // namespace hyper_engine
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "hyper_core/filesystem.hpp"
 
 #include <fstream>
+#include <string>
 
 namespace hyper_engine::filesystem
 {
@@ -26,4 +27,17 @@ namespace hyper_engine::filesystem
 
         return data;
     }
+
+    bool write_file(const std::string_view path, const std::span<const uint8_t> data)
+    {
+        std::ofstream file(std::string(path), std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+
+        return file.good();
+    }
 } // namespace hyper_engine::filesystem
\ No newline at end of file
@@ -0,0 +1,392 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_core/flight_recorder.hpp"
+
+#include <algorithm>
+#include <csignal>
+#include <cstring>
+#include <memory>
+
+#include <libassert/assert.hpp>
+
+#if HE_WINDOWS
+#    include <fcntl.h>
+#    include <io.h>
+#    include <sys/stat.h>
+#else
+#    include <fcntl.h>
+#    include <signal.h>
+#    include <unistd.h>
+#endif
+
+namespace hyper_engine
+{
+    static constexpr std::array<const char *, static_cast<size_t>(FramePhase::Count)> g_phase_names = {
+        "events",
+        "fixed_update",
+        "update",
+        "render",
+        "present",
+    };
+
+    static constexpr std::array<int, 2> g_crash_signals = {
+        SIGSEGV,
+        SIGABRT,
+    };
+
+    static std::atomic<bool> g_dumped = false;
+
+#if !HE_WINDOWS
+    static std::array<struct sigaction, g_crash_signals.size()> g_previous_actions = {};
+
+    // NOTE: Stack overflows can't run the handler on the faulting stack, so it runs on an alternate one. The alternate stack is a
+    //       per-thread setting, every thread that may crash has to register its own.
+    class SignalStack
+    {
+    public:
+        static constexpr size_t s_size = 64 * 1024;
+
+    public:
+        SignalStack()
+            : m_memory(std::make_unique<uint8_t[]>(s_size))
+        {
+        }
+
+        ~SignalStack()
+        {
+            disable();
+        }
+
+        SignalStack(const SignalStack &) = delete;
+        SignalStack &operator=(const SignalStack &) = delete;
+
+        void enable() const
+        {
+            stack_t signal_stack = {};
+            signal_stack.ss_sp = m_memory.get();
+            signal_stack.ss_size = s_size;
+            signal_stack.ss_flags = 0;
+            sigaltstack(&signal_stack, nullptr);
+        }
+
+        static void disable()
+        {
+            stack_t signal_stack = {};
+            signal_stack.ss_flags = SS_DISABLE;
+            sigaltstack(&signal_stack, nullptr);
+        }
+
+    private:
+        std::unique_ptr<uint8_t[]> m_memory;
+    };
+
+    static thread_local SignalStack g_signal_stack;
+#endif
+
+    // NOTE: Formats by hand into a stack buffer and writes to a raw file descriptor, as printf isn't async signal safe
+    class DumpWriter
+    {
+    public:
+        explicit DumpWriter(const int file)
+            : m_file(file)
+        {
+        }
+
+        ~DumpWriter()
+        {
+            flush();
+        }
+
+        DumpWriter &text(const char *value)
+        {
+            while (*value != '\0')
+            {
+                put(*value++);
+            }
+
+            return *this;
+        }
+
+        DumpWriter &number(uint64_t value)
+        {
+            std::array<char, 20> digits = {};
+            size_t digit_count = 0;
+            do
+            {
+                digits[digit_count++] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            } while (value != 0);
+
+            while (digit_count > 0)
+            {
+                put(digits[--digit_count]);
+            }
+
+            return *this;
+        }
+
+        // NOTE: Three fractional digits, negative and non-finite values are written as zero
+        DumpWriter &fixed(const float value)
+        {
+            const float clamped_value = value > 0.0f && value < 1.0e9f ? value : 0.0f;
+            const uint64_t thousandths = static_cast<uint64_t>(clamped_value * 1000.0f + 0.5f);
+            const uint64_t fraction = thousandths % 1000;
+
+            number(thousandths / 1000);
+            put('.');
+            put(static_cast<char>('0' + fraction / 100));
+            put(static_cast<char>('0' + fraction / 10 % 10));
+            put(static_cast<char>('0' + fraction % 10));
+
+            return *this;
+        }
+
+        void flush()
+        {
+            if (m_size == 0)
+            {
+                return;
+            }
+
+#if HE_WINDOWS
+            _write(m_file, m_buffer.data(), static_cast<unsigned int>(m_size));
+#else
+            [[maybe_unused]] const ssize_t written = ::write(m_file, m_buffer.data(), m_size);
+#endif
+            m_size = 0;
+        }
+
+    private:
+        void put(const char character)
+        {
+            if (m_size == m_buffer.size())
+            {
+                flush();
+            }
+
+            m_buffer[m_size++] = character;
+        }
+
+    private:
+        int m_file = -1;
+        std::array<char, 512> m_buffer = {};
+        size_t m_size = 0;
+    };
+
+    static void write_frame(DumpWriter &writer, const FrameRecord &frame)
+    {
+        writer.text("frame ")
+            .number(frame.frame_index)
+            .text(" created=")
+            .number(frame.resources_created)
+            .text(" destroyed=")
+            .number(frame.resources_destroyed)
+            .text(" passes=")
+            .number(frame.pass_count)
+            .text(" memory=")
+            .number(frame.memory_usage)
+            .text("/")
+            .number(frame.memory_budget);
+
+        for (size_t phase = 0; phase < frame.phase_times.size(); ++phase)
+        {
+            writer.text(" ").text(g_phase_names[phase]).text("=").fixed(frame.phase_times[phase]).text("ms");
+        }
+
+        writer.text("\n");
+    }
+
+    static void on_assertion_failure(const libassert::assertion_info &info)
+    {
+        if (FlightRecorder *flight_recorder = FlightRecorder::get(); flight_recorder != nullptr && !g_dumped.exchange(true))
+        {
+            flight_recorder->dump(FlightRecorder::s_dump_path);
+        }
+
+        libassert::default_failure_handler(info);
+    }
+
+    FlightRecorder::FlightRecorder()
+    {
+        FlightRecorder::install_crash_handlers();
+    }
+
+    FlightRecorder::~FlightRecorder()
+    {
+        FlightRecorder::restore_crash_handlers();
+    }
+
+    void FlightRecorder::begin_frame(const uint64_t frame_index)
+    {
+        m_current_frame = {};
+        m_current_frame.frame_index = frame_index;
+    }
+
+    void FlightRecorder::end_frame()
+    {
+        m_current_frame.resources_created = m_resources_created.exchange(0, std::memory_order_relaxed);
+        m_current_frame.resources_destroyed = m_resources_destroyed.exchange(0, std::memory_order_relaxed);
+
+        const uint64_t frame_count = m_frame_count.load(std::memory_order_relaxed);
+        m_frames[frame_count % s_frame_capacity] = m_current_frame;
+        m_frame_count.store(frame_count + 1, std::memory_order_release);
+    }
+
+    void FlightRecorder::record_phase(const FramePhase phase, const float milliseconds)
+    {
+        m_current_frame.phase_times[static_cast<size_t>(phase)] += milliseconds;
+    }
+
+    void FlightRecorder::record_pass(const std::string_view label)
+    {
+        const uint64_t pass_count = m_pass_count.load(std::memory_order_relaxed);
+
+        PassRecord &pass = m_passes[pass_count % s_pass_capacity];
+        pass.frame_index = m_current_frame.frame_index;
+
+        const size_t length = std::min(label.size(), pass.label.size() - 1);
+        std::memcpy(pass.label.data(), label.data(), length);
+        pass.label[length] = '\0';
+
+        m_pass_count.store(pass_count + 1, std::memory_order_release);
+
+        m_current_frame.pass_count += 1;
+    }
+
+    void FlightRecorder::record_resources_created(const uint32_t count)
+    {
+        m_resources_created.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    void FlightRecorder::record_resources_destroyed(const uint32_t count)
+    {
+        m_resources_destroyed.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    void FlightRecorder::record_memory(const uint64_t usage, const uint64_t budget)
+    {
+        m_current_frame.memory_usage = usage;
+        m_current_frame.memory_budget = budget;
+    }
+
+    void FlightRecorder::dump(const char *path) const
+    {
+#if HE_WINDOWS
+        const int file = _open(path, _O_CREAT | _O_TRUNC | _O_WRONLY, _S_IREAD | _S_IWRITE);
+#else
+        const int file = ::open(path, O_CREAT | O_TRUNC | O_WRONLY, 0644);
+#endif
+        if (file < 0)
+        {
+            return;
+        }
+
+        {
+            DumpWriter writer(file);
+
+            const uint64_t frame_count = m_frame_count.load(std::memory_order_acquire);
+            const uint64_t first_frame = frame_count - std::min<uint64_t>(frame_count, s_frame_capacity);
+
+            writer.text("# frames ").number(frame_count - first_frame).text("\n");
+            for (uint64_t index = first_frame; index < frame_count; ++index)
+            {
+                write_frame(writer, m_frames[index % s_frame_capacity]);
+            }
+
+            // NOTE: The frame the crash happened in hasn't reached the ring yet, its resource counts are still pending
+            FrameRecord current_frame = m_current_frame;
+            current_frame.resources_created = m_resources_created.load(std::memory_order_relaxed);
+            current_frame.resources_destroyed = m_resources_destroyed.load(std::memory_order_relaxed);
+
+            writer.text("# current frame\n");
+            write_frame(writer, current_frame);
+
+            const uint64_t pass_count = m_pass_count.load(std::memory_order_acquire);
+            const uint64_t first_pass = pass_count - std::min<uint64_t>(pass_count, s_pass_capacity);
+
+            writer.text("# passes ").number(pass_count - first_pass).text("\n");
+            for (uint64_t index = first_pass; index < pass_count; ++index)
+            {
+                const PassRecord &pass = m_passes[index % s_pass_capacity];
+                writer.text("pass ").number(pass.frame_index).text(" ").text(pass.label.data()).text("\n");
+            }
+        }
+
+#if HE_WINDOWS
+        _close(file);
+#else
+        ::close(file);
+#endif
+    }
+
+    FlightRecorder *&FlightRecorder::get()
+    {
+        static FlightRecorder *flight_recorder = nullptr;
+        return flight_recorder;
+    }
+
+    void FlightRecorder::install_crash_handlers()
+    {
+        libassert::set_failure_handler(on_assertion_failure);
+
+#if HE_WINDOWS
+        for (const int signal : g_crash_signals)
+        {
+            std::signal(signal, FlightRecorder::on_signal);
+        }
+#else
+        FlightRecorder::install_signal_stack();
+
+        struct sigaction action = {};
+        action.sa_handler = FlightRecorder::on_signal;
+        action.sa_flags = SA_ONSTACK | SA_RESETHAND;
+        sigemptyset(&action.sa_mask);
+
+        for (size_t index = 0; index < g_crash_signals.size(); ++index)
+        {
+            sigaction(g_crash_signals[index], &action, &g_previous_actions[index]);
+        }
+#endif
+    }
+
+    void FlightRecorder::restore_crash_handlers()
+    {
+        libassert::set_failure_handler(libassert::default_failure_handler);
+
+#if HE_WINDOWS
+        for (const int signal : g_crash_signals)
+        {
+            std::signal(signal, SIG_DFL);
+        }
+#else
+        for (size_t index = 0; index < g_crash_signals.size(); ++index)
+        {
+            sigaction(g_crash_signals[index], &g_previous_actions[index], nullptr);
+        }
+
+        SignalStack::disable();
+#endif
+    }
+
+    void FlightRecorder::install_signal_stack()
+    {
+#if !HE_WINDOWS
+        g_signal_stack.enable();
+#endif
+    }
+
+    void FlightRecorder::on_signal(const int signal)
+    {
+        if (FlightRecorder *flight_recorder = FlightRecorder::get(); flight_recorder != nullptr && !g_dumped.exchange(true))
+        {
+            flight_recorder->dump(FlightRecorder::s_dump_path);
+        }
+
+        std::signal(signal, SIG_DFL);
+        std::raise(signal);
+    }
+} // namespace hyper_engine
\ No newline at end of file
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_core/frustum_culling.hpp"
+
+#include <cmath>
+
+#include "hyper_core/assertion.hpp"
+#include "hyper_core/simd.hpp"
+
+namespace hyper_engine
+{
+    void BoundingBoxBatch::clear()
+    {
+        center_x.clear();
+        center_y.clear();
+        center_z.clear();
+        extents_x.clear();
+        extents_y.clear();
+        extents_z.clear();
+    }
+
+    void BoundingBoxBatch::reserve(const size_t count)
+    {
+        center_x.reserve(count);
+        center_y.reserve(count);
+        center_z.reserve(count);
+        extents_x.reserve(count);
+        extents_y.reserve(count);
+        extents_z.reserve(count);
+    }
+
+    void BoundingBoxBatch::push_back(const BoundingBox &box)
+    {
+        const glm::vec3 center = box.center();
+        const glm::vec3 extents = box.extents();
+
+        center_x.push_back(center.x);
+        center_y.push_back(center.y);
+        center_z.push_back(center.z);
+        extents_x.push_back(extents.x);
+        extents_y.push_back(extents.y);
+        extents_z.push_back(extents.z);
+    }
+
+    size_t BoundingBoxBatch::size() const
+    {
+        return center_x.size();
+    }
+
+    static bool is_visible(const Frustum &frustum, const BoundingBoxBatch &boxes, const size_t index)
+    {
+        for (const glm::vec4 &plane : frustum.planes)
+        {
+            const float distance = plane.x * boxes.center_x[index] + plane.y * boxes.center_y[index] + plane.z * boxes.center_z[index] + plane.w;
+            const float radius =
+                std::abs(plane.x) * boxes.extents_x[index] + std::abs(plane.y) * boxes.extents_y[index] + std::abs(plane.z) * boxes.extents_z[index];
+            if (distance + radius < 0.0f)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+#if HE_SIMD_AVX2
+    // NOTE: Culls eight boxes per iteration and returns the number of culled boxes, the rest is left to the narrower paths
+    HE_TARGET_AVX2 static size_t cull_boxes_avx2(const Frustum &frustum, const BoundingBoxBatch &boxes, const std::span<uint8_t> visibility)
+    {
+        size_t index = 0;
+        for (; index + 8 <= boxes.size(); index += 8)
+        {
+            const __m256 center_x = _mm256_loadu_ps(&boxes.center_x[index]);
+            const __m256 center_y = _mm256_loadu_ps(&boxes.center_y[index]);
+            const __m256 center_z = _mm256_loadu_ps(&boxes.center_z[index]);
+            const __m256 extents_x = _mm256_loadu_ps(&boxes.extents_x[index]);
+            const __m256 extents_y = _mm256_loadu_ps(&boxes.extents_y[index]);
+            const __m256 extents_z = _mm256_loadu_ps(&boxes.extents_z[index]);
+
+            __m256 outside = _mm256_setzero_ps();
+            for (const glm::vec4 &plane : frustum.planes)
+            {
+                __m256 distance = _mm256_set1_ps(plane.w);
+                distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.x), center_x));
+                distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.y), center_y));
+                distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.z), center_z));
+
+                __m256 radius = _mm256_mul_ps(_mm256_set1_ps(std::abs(plane.x)), extents_x);
+                radius = _mm256_add_ps(radius, _mm256_mul_ps(_mm256_set1_ps(std::abs(plane.y)), extents_y));
+                radius = _mm256_add_ps(radius, _mm256_mul_ps(_mm256_set1_ps(std::abs(plane.z)), extents_z));
+
+                outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(distance, radius), _mm256_setzero_ps(), _CMP_LT_OQ));
+            }
+
+            const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_ps(outside));
+            for (uint32_t lane = 0; lane < 8; ++lane)
+            {
+                visibility[index + lane] = static_cast<uint8_t>(((mask >> lane) & 1) ^ 1);
+            }
+        }
+
+        return index;
+    }
+#endif
+
+    void cull_boxes(const Frustum &frustum, const BoundingBoxBatch &boxes, const std::span<uint8_t> visibility)
+    {
+        HE_ASSERT(visibility.size() >= boxes.size());
+
+        size_t index = 0;
+
+#if HE_SIMD_AVX2
+        static const bool avx2_supported = cpu_supports_avx2();
+        if (avx2_supported)
+        {
+            index = cull_boxes_avx2(frustum, boxes, visibility);
+        }
+#endif
+
+#if HE_SIMD_SSE
+        for (; index + 4 <= boxes.size(); index += 4)
+        {
+            const __m128 center_x = _mm_loadu_ps(&boxes.center_x[index]);
+            const __m128 center_y = _mm_loadu_ps(&boxes.center_y[index]);
+            const __m128 center_z = _mm_loadu_ps(&boxes.center_z[index]);
+            const __m128 extents_x = _mm_loadu_ps(&boxes.extents_x[index]);
+            const __m128 extents_y = _mm_loadu_ps(&boxes.extents_y[index]);
+            const __m128 extents_z = _mm_loadu_ps(&boxes.extents_z[index]);
+
+            __m128 outside = _mm_setzero_ps();
+            for (const glm::vec4 &plane : frustum.planes)
+            {
+                __m128 distance = _mm_set1_ps(plane.w);
+                distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.x), center_x));
+                distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.y), center_y));
+                distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.z), center_z));
+
+                __m128 radius = _mm_mul_ps(_mm_set1_ps(std::abs(plane.x)), extents_x);
+                radius = _mm_add_ps(radius, _mm_mul_ps(_mm_set1_ps(std::abs(plane.y)), extents_y));
+                radius = _mm_add_ps(radius, _mm_mul_ps(_mm_set1_ps(std::abs(plane.z)), extents_z));
+
+                outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, radius), _mm_setzero_ps()));
+            }
+
+            const uint32_t mask = static_cast<uint32_t>(_mm_movemask_ps(outside));
+            for (uint32_t lane = 0; lane < 4; ++lane)
+            {
+                visibility[index + lane] = static_cast<uint8_t>(((mask >> lane) & 1) ^ 1);
+            }
+        }
+#elif HE_SIMD_NEON
+        for (; index + 4 <= boxes.size(); index += 4)
+        {
+            const float32x4_t center_x = vld1q_f32(&boxes.center_x[index]);
+            const float32x4_t center_y = vld1q_f32(&boxes.center_y[index]);
+            const float32x4_t center_z = vld1q_f32(&boxes.center_z[index]);
+            const float32x4_t extents_x = vld1q_f32(&boxes.extents_x[index]);
+            const float32x4_t extents_y = vld1q_f32(&boxes.extents_y[index]);
+            const float32x4_t extents_z = vld1q_f32(&boxes.extents_z[index]);
+
+            uint32x4_t outside = vdupq_n_u32(0);
+            for (const glm::vec4 &plane : frustum.planes)
+            {
+                float32x4_t distance = vdupq_n_f32(plane.w);
+                distance = vmlaq_n_f32(distance, center_x, plane.x);
+                distance = vmlaq_n_f32(distance, center_y, plane.y);
+                distance = vmlaq_n_f32(distance, center_z, plane.z);
+
+                float32x4_t radius = vmulq_n_f32(extents_x, std::abs(plane.x));
+                radius = vmlaq_n_f32(radius, extents_y, std::abs(plane.y));
+                radius = vmlaq_n_f32(radius, extents_z, std::abs(plane.z));
+
+                outside = vorrq_u32(outside, vcltq_f32(vaddq_f32(distance, radius), vdupq_n_f32(0.0f)));
+            }
+
+            visibility[index + 0] = vgetq_lane_u32(outside, 0) == 0;
+            visibility[index + 1] = vgetq_lane_u32(outside, 1) == 0;
+            visibility[index + 2] = vgetq_lane_u32(outside, 2) == 0;
+            visibility[index + 3] = vgetq_lane_u32(outside, 3) == 0;
+        }
+#endif
+
+        for (; index < boxes.size(); ++index)
+        {
+            visibility[index] = is_visible(frustum, boxes, index) ? 1 : 0;
+        }
+    }
+} // namespace hyper_engine
\ No newline at end of file
@@ -6,6 +6,7 @@
 
 #include "hyper_core/job_system.hpp"
 
+#include "hyper_core/flight_recorder.hpp"
 #include "hyper_core/logger.hpp"
 
 #include <algorithm>
@@ -13,6 +14,8 @@
 
 namespace hyper_engine
 {
+    static thread_local uint32_t g_thread_index = 0;
+
     JobSystem::JobSystem()
     {
         m_finished_label.store(0);
@@ -23,8 +26,12 @@ namespace hyper_engine
         for (uint32_t thread_id = 0; thread_id < m_thread_count; ++thread_id)
         {
             std::thread worker_thread(
-                [this]()
+                [this, thread_id]()
                 {
+                    g_thread_index = thread_id + 1;
+
+                    FlightRecorder::install_signal_stack();
+
                     std::function<void()> job;
 
                     while (true)
@@ -59,6 +66,18 @@ namespace hyper_engine
         m_wake_condition.notify_one();
     }
 
+    void JobSystem::execute(JobContext &context, const std::function<void()> &job)
+    {
+        context.pending_count.fetch_add(1, std::memory_order_relaxed);
+
+        execute(
+            [&context, job]()
+            {
+                job();
+                context.pending_count.fetch_sub(1, std::memory_order_release);
+            });
+    }
+
     void JobSystem::dispatch(const uint32_t job_count, const uint32_t group_size, const std::function<void(DispatchArgs)> &job)
     {
         if (job_count == 0 || group_size == 0)
@@ -96,11 +115,46 @@ namespace hyper_engine
         }
     }
 
+    void JobSystem::dispatch(
+        JobContext &context,
+        const uint32_t job_count,
+        const uint32_t group_size,
+        const std::function<void(DispatchArgs)> &job)
+    {
+        if (job_count == 0 || group_size == 0)
+        {
+            return;
+        }
+
+        const uint32_t group_count = (job_count + group_size - 1) / group_size;
+        context.pending_count.fetch_add(group_count, std::memory_order_relaxed);
+
+        dispatch(
+            job_count,
+            group_size,
+            [&context, job_count, group_size, job](const DispatchArgs args)
+            {
+                job(args);
+
+                // NOTE: The jobs of a group run in order on one thread, so the last one finishes the group
+                const uint32_t group_job_end = std::min((args.group_index + 1) * group_size, job_count);
+                if (args.job_index + 1 == group_job_end)
+                {
+                    context.pending_count.fetch_sub(1, std::memory_order_release);
+                }
+            });
+    }
+
     bool JobSystem::is_busy() const
     {
         return m_finished_label.load() < m_current_label;
     }
 
+    bool JobSystem::is_busy(const JobContext &context)
+    {
+        return context.pending_count.load(std::memory_order_acquire) > 0;
+    }
+
     void JobSystem::wait_for_idle()
     {
         while (is_busy())
@@ -110,6 +164,25 @@ namespace hyper_engine
         }
     }
 
+    void JobSystem::wait(const JobContext &context)
+    {
+        while (JobSystem::is_busy(context))
+        {
+            m_wake_condition.notify_one();
+            std::this_thread::yield();
+        }
+    }
+
+    uint32_t JobSystem::thread_count() const
+    {
+        return m_thread_count + 1;
+    }
+
+    uint32_t JobSystem::thread_index()
+    {
+        return g_thread_index;
+    }
+
     JobSystem *&JobSystem::get()
     {
         static JobSystem *job_system = nullptr;
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_core/mapped_file.hpp"
+
+#include <string>
+#include <utility>
+
+#if HE_WINDOWS
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace hyper_engine
+{
+    MappedFile::MappedFile(const std::string_view path)
+    {
+        const std::string path_string(path);
+
+#if HE_WINDOWS
+        m_file = CreateFileA(path_string.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (m_file == INVALID_HANDLE_VALUE)
+        {
+            m_file = nullptr;
+            return;
+        }
+
+        LARGE_INTEGER file_size = {};
+        if (!GetFileSizeEx(m_file, &file_size) || file_size.QuadPart == 0)
+        {
+            unmap();
+            return;
+        }
+
+        m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (m_mapping == nullptr)
+        {
+            unmap();
+            return;
+        }
+
+        m_data = static_cast<const uint8_t *>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (m_data == nullptr)
+        {
+            unmap();
+            return;
+        }
+
+        m_size = static_cast<size_t>(file_size.QuadPart);
+#else
+        const int file = ::open(path_string.c_str(), O_RDONLY);
+        if (file < 0)
+        {
+            return;
+        }
+
+        struct stat file_stat = {};
+        if (::fstat(file, &file_stat) != 0 || file_stat.st_size == 0)
+        {
+            ::close(file);
+            return;
+        }
+
+        void *data = ::mmap(nullptr, static_cast<size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        ::close(file);
+
+        if (data == MAP_FAILED)
+        {
+            return;
+        }
+
+        m_data = static_cast<const uint8_t *>(data);
+        m_size = static_cast<size_t>(file_stat.st_size);
+#endif
+    }
+
+    MappedFile::~MappedFile()
+    {
+        unmap();
+    }
+
+    MappedFile::MappedFile(MappedFile &&other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr))
+        , m_size(std::exchange(other.m_size, 0))
+#if HE_WINDOWS
+        , m_file(std::exchange(other.m_file, nullptr))
+        , m_mapping(std::exchange(other.m_mapping, nullptr))
+#endif
+    {
+    }
+
+    MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+    {
+        if (this != &other)
+        {
+            unmap();
+
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+#if HE_WINDOWS
+            m_file = std::exchange(other.m_file, nullptr);
+            m_mapping = std::exchange(other.m_mapping, nullptr);
+#endif
+        }
+
+        return *this;
+    }
+
+    bool MappedFile::is_valid() const
+    {
+        return m_data != nullptr;
+    }
+
+    std::span<const uint8_t> MappedFile::data() const
+    {
+        return {m_data, m_size};
+    }
+
+    size_t MappedFile::size() const
+    {
+        return m_size;
+    }
+
+    void MappedFile::unmap()
+    {
+#if HE_WINDOWS
+        if (m_data != nullptr)
+        {
+            UnmapViewOfFile(m_data);
+        }
+
+        if (m_mapping != nullptr)
+        {
+            CloseHandle(m_mapping);
+        }
+
+        if (m_file != nullptr)
+        {
+            CloseHandle(m_file);
+        }
+
+        m_file = nullptr;
+        m_mapping = nullptr;
+#else
+        if (m_data != nullptr)
+        {
+            ::munmap(const_cast<uint8_t *>(m_data), m_size);
+        }
+#endif
+
+        m_data = nullptr;
+        m_size = 0;
+    }
+} // namespace hyper_engine
\ No newline at end of file
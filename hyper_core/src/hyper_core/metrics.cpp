@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_core/metrics.hpp"
+
+#include <algorithm>
+#include <bit>
+
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "hyper_core/logger.hpp"
+
+namespace hyper_engine
+{
+    static size_t current_shard_index()
+    {
+        static std::atomic<size_t> next_index = 0;
+        thread_local const size_t shard_index = next_index.fetch_add(1, std::memory_order_relaxed) % g_metric_shard_count;
+        return shard_index;
+    }
+
+    void Counter::add(const uint64_t value)
+    {
+        m_shards[current_shard_index()].value.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    uint64_t Counter::value() const
+    {
+        uint64_t value = 0;
+        for (const Shard &shard : m_shards)
+        {
+            value += shard.value.load(std::memory_order_relaxed);
+        }
+
+        return value;
+    }
+
+    void Gauge::set(const int64_t value)
+    {
+        m_value.store(value, std::memory_order_relaxed);
+    }
+
+    void Gauge::add(const int64_t value)
+    {
+        m_value.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    int64_t Gauge::value() const
+    {
+        return m_value.load(std::memory_order_relaxed);
+    }
+
+    uint64_t HistogramSnapshot::percentile(const double fraction) const
+    {
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        const uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(static_cast<double>(count) * fraction));
+
+        uint64_t accumulated = 0;
+        for (size_t index = 0; index < s_bucket_count; ++index)
+        {
+            accumulated += buckets[index];
+            if (accumulated >= target)
+            {
+                // NOTE: Reports the upper bound of the bucket
+                return index == 0 ? 0 : std::min(max, (uint64_t(1) << index) - 1);
+            }
+        }
+
+        return max;
+    }
+
+    void Histogram::record(const uint64_t value)
+    {
+        const size_t bucket = std::min<size_t>(std::bit_width(value), HistogramSnapshot::s_bucket_count - 1);
+
+        Shard &shard = m_shards[current_shard_index()];
+        shard.count.fetch_add(1, std::memory_order_relaxed);
+        shard.sum.fetch_add(value, std::memory_order_relaxed);
+        shard.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+
+        uint64_t max = shard.max.load(std::memory_order_relaxed);
+        while (value > max && !shard.max.compare_exchange_weak(max, value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    HistogramSnapshot Histogram::snapshot() const
+    {
+        HistogramSnapshot snapshot = {};
+        for (const Shard &shard : m_shards)
+        {
+            snapshot.count += shard.count.load(std::memory_order_relaxed);
+            snapshot.sum += shard.sum.load(std::memory_order_relaxed);
+            snapshot.max = std::max(snapshot.max, shard.max.load(std::memory_order_relaxed));
+
+            for (size_t index = 0; index < HistogramSnapshot::s_bucket_count; ++index)
+            {
+                snapshot.buckets[index] += shard.buckets[index].load(std::memory_order_relaxed);
+            }
+        }
+
+        return snapshot;
+    }
+
+    Counter &MetricsRegistry::counter(const std::string_view name)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto iterator = m_counters.find(name);
+        if (iterator == m_counters.end())
+        {
+            iterator = m_counters.emplace(std::string(name), make_own<Counter>()).first;
+        }
+
+        return *iterator->second;
+    }
+
+    Gauge &MetricsRegistry::gauge(const std::string_view name)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto iterator = m_gauges.find(name);
+        if (iterator == m_gauges.end())
+        {
+            iterator = m_gauges.emplace(std::string(name), make_own<Gauge>()).first;
+        }
+
+        return *iterator->second;
+    }
+
+    Histogram &MetricsRegistry::histogram(const std::string_view name)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto iterator = m_histograms.find(name);
+        if (iterator == m_histograms.end())
+        {
+            iterator = m_histograms.emplace(std::string(name), make_own<Histogram>()).first;
+        }
+
+        return *iterator->second;
+    }
+
+    void MetricsRegistry::set_export(const std::string_view path, const std::chrono::milliseconds interval)
+    {
+        m_export_interval = interval;
+        m_last_export_time = std::chrono::steady_clock::now();
+
+        m_export_file.close();
+        if (path.empty())
+        {
+            return;
+        }
+
+        m_export_file.open(std::string(path), std::ios::out | std::ios::trunc);
+        if (!m_export_file.is_open())
+        {
+            HE_WARN("Failed to open metrics export file '{}'", path);
+            return;
+        }
+
+        HE_INFO("Exporting metrics to '{}' every {}ms", path, interval.count());
+    }
+
+    void MetricsRegistry::update()
+    {
+        if (!m_export_file.is_open())
+        {
+            return;
+        }
+
+        const std::chrono::steady_clock::time_point current_time = std::chrono::steady_clock::now();
+        if (current_time - m_last_export_time < m_export_interval)
+        {
+            return;
+        }
+
+        m_last_export_time = current_time;
+
+        write(m_export_file);
+        m_export_file.flush();
+    }
+
+    void MetricsRegistry::write(std::ostream &stream) const
+    {
+        const auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_start_time);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // NOTE: One metric per line: <timestamp ms> <type> <name> <values...>
+        for (const auto &[name, counter] : m_counters)
+        {
+            fmt::print(stream, "{} counter {} {}\n", timestamp.count(), name, counter->value());
+        }
+
+        for (const auto &[name, gauge] : m_gauges)
+        {
+            fmt::print(stream, "{} gauge {} {}\n", timestamp.count(), name, gauge->value());
+        }
+
+        for (const auto &[name, histogram] : m_histograms)
+        {
+            const HistogramSnapshot snapshot = histogram->snapshot();
+            fmt::print(
+                stream,
+                "{} histogram {} count={} sum={} max={} p50={} p90={} p99={}\n",
+                timestamp.count(),
+                name,
+                snapshot.count,
+                snapshot.sum,
+                snapshot.max,
+                snapshot.percentile(0.5),
+                snapshot.percentile(0.9),
+                snapshot.percentile(0.99));
+        }
+    }
+
+    MetricsRegistry *&MetricsRegistry::get()
+    {
+        static MetricsRegistry *metrics_registry = nullptr;
+        return metrics_registry;
+    }
+} // namespace hyper_engine
\ No newline at end of file
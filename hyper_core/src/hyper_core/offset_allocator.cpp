@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_core/offset_allocator.hpp"
+
+#include <iterator>
+
+#include "hyper_core/assertion.hpp"
+
+namespace hyper_engine
+{
+    OffsetAllocator::OffsetAllocator(const uint64_t size)
+        : m_size(size)
+        , m_free_size(size)
+    {
+        if (size > 0)
+        {
+            m_free_ranges.emplace(0, size);
+        }
+    }
+
+    uint64_t OffsetAllocator::allocate(const uint64_t size)
+    {
+        HE_ASSERT(size > 0);
+
+        for (auto range = m_free_ranges.begin(); range != m_free_ranges.end(); ++range)
+        {
+            const auto [offset, range_size] = *range;
+            if (range_size < size)
+            {
+                continue;
+            }
+
+            m_free_ranges.erase(range);
+            if (range_size > size)
+            {
+                m_free_ranges.emplace(offset + size, range_size - size);
+            }
+
+            m_free_size -= size;
+            return offset;
+        }
+
+        return s_invalid_offset;
+    }
+
+    void OffsetAllocator::free(const uint64_t offset, uint64_t size)
+    {
+        HE_ASSERT(size > 0);
+        HE_ASSERT(offset + size <= m_size);
+
+        m_free_size += size;
+
+        const auto next = m_free_ranges.lower_bound(offset);
+        HE_ASSERT(next == m_free_ranges.end() || offset + size <= next->first, "The range overlaps a free range");
+
+        if (next != m_free_ranges.end() && offset + size == next->first)
+        {
+            size += next->second;
+            m_free_ranges.erase(next);
+        }
+
+        const auto inserted = m_free_ranges.emplace(offset, size).first;
+        if (inserted == m_free_ranges.begin())
+        {
+            return;
+        }
+
+        const auto previous = std::prev(inserted);
+        HE_ASSERT(previous->first + previous->second <= offset, "The range overlaps a free range");
+
+        if (previous->first + previous->second == offset)
+        {
+            previous->second += size;
+            m_free_ranges.erase(inserted);
+        }
+    }
+
+    uint64_t OffsetAllocator::size() const
+    {
+        return m_size;
+    }
+
+    uint64_t OffsetAllocator::free_size() const
+    {
+        return m_free_size;
+    }
+
+    uint32_t OffsetAllocator::free_range_count() const
+    {
+        return static_cast<uint32_t>(m_free_ranges.size());
+    }
+} // namespace hyper_engine
\ No newline at end of file
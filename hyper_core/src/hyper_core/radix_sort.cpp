@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_core/radix_sort.hpp"
+
+#include <algorithm>
+#include <array>
+
+#include "hyper_core/assertion.hpp"
+
+namespace hyper_engine
+{
+    void radix_sort(const std::span<SortEntry> entries, const std::span<SortEntry> scratch)
+    {
+        HE_ASSERT(scratch.size() >= entries.size());
+
+        constexpr uint32_t digit_count = sizeof(uint64_t);
+        constexpr uint32_t bucket_count = 256;
+
+        // NOTE: Counts every digit in a single pass over the keys
+        std::array<std::array<uint32_t, bucket_count>, digit_count> histograms = {};
+        for (const SortEntry &entry : entries)
+        {
+            for (uint32_t digit = 0; digit < digit_count; ++digit)
+            {
+                histograms[digit][(entry.key >> (digit * 8)) & 0xff] += 1;
+            }
+        }
+
+        std::span<SortEntry> source = entries;
+        std::span<SortEntry> destination = scratch.first(entries.size());
+        for (uint32_t digit = 0; digit < digit_count; ++digit)
+        {
+            std::array<uint32_t, bucket_count> &histogram = histograms[digit];
+            if (std::ranges::find(histogram, static_cast<uint32_t>(entries.size())) != histogram.end())
+            {
+                continue;
+            }
+
+            uint32_t offset = 0;
+            for (uint32_t &count : histogram)
+            {
+                const uint32_t bucket_size = count;
+                count = offset;
+                offset += bucket_size;
+            }
+
+            for (const SortEntry &entry : source)
+            {
+                destination[histogram[(entry.key >> (digit * 8)) & 0xff]++] = entry;
+            }
+
+            std::swap(source, destination);
+        }
+
+        if (source.data() != entries.data())
+        {
+            std::ranges::copy(source, entries.begin());
+        }
+    }
+} // namespace hyper_engine
\ No newline at end of file
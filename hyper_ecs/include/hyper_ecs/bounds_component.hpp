@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <hyper_core/bounds.hpp>
+
+namespace hyper_engine
+{
+    // NOTE: Bounds in local space, the SpatialIndex transforms them with the cached world matrix
+    struct BoundsComponent
+    {
+        BoundingBox box;
+    };
+} // namespace hyper_engine
\ No newline at end of file
@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <hyper_core/math.hpp>
+
+namespace hyper_engine
+{
+    // NOTE: Marks entities which are moved every frame, the rotation advances by the angular velocity in radians per second
+    struct DynamicComponent
+    {
+        glm::vec3 angular_velocity = {0.0f, 0.0f, 0.0f};
+    };
+} // namespace hyper_engine
\ No newline at end of file
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <entt/entt.hpp>
+
+namespace hyper_engine
+{
+    // NOTE: Creates all entities at once and reserves the storage of the given components up front, so the following bulk inserts
+    //       don't reallocate the pools
+    template <typename... Components>
+    std::vector<entt::entity> create_entities(entt::registry &registry, const size_t count)
+    {
+        registry.storage<entt::entity>().reserve(registry.storage<entt::entity>().size() + count);
+        (registry.storage<Components>().reserve(registry.storage<Components>().size() + count), ...);
+
+        std::vector<entt::entity> entities(count);
+        registry.create(entities.begin(), entities.end());
+
+        return entities;
+    }
+} // namespace hyper_engine
\ No newline at end of file
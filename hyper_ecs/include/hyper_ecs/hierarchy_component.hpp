@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <entt/entt.hpp>
+
+namespace hyper_engine
+{
+    // NOTE: Only change the parent through TransformHierarchy::set_parent or registry.patch, so the hierarchy gets rebuilt
+    struct HierarchyComponent
+    {
+        entt::entity parent = entt::null;
+    };
+} // namespace hyper_engine
\ No newline at end of file
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include <hyper_core/ref_ptr.hpp>
 
 namespace hyper_engine
@@ -15,5 +17,8 @@ namespace hyper_engine
     struct ModelComponent
     {
         RefPtr<Model> model;
+        // FIXME: Indices into the loaded models and materials, until models are assets
+        uint32_t model_index = 0;
+        uint32_t material_index = 0;
     };
 } // namespace hyper_engine
\ No newline at end of file
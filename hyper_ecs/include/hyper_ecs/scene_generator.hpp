@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <entt/entt.hpp>
+
+namespace hyper_engine
+{
+    struct SceneGeneratorDescriptor
+    {
+        uint32_t entity_count = 0;
+        uint32_t model_count = 1;
+        uint32_t material_count = 1;
+        // NOTE: Exponent of the Zipf distribution the models and materials are picked with, zero picks every variant equally often
+        float variant_skew = 0.0f;
+        // NOTE: Entities are created in chains of parents and children, a depth of zero creates only root entities
+        uint32_t hierarchy_depth = 0;
+        float dynamic_fraction = 0.0f;
+        float spacing = 2.0f;
+        uint32_t seed = 0;
+    };
+
+    // NOTE: Creates repeatable large scale workloads, the same descriptor always creates the same scene
+    class SceneGenerator
+    {
+    public:
+        static void generate(entt::registry &registry, const SceneGeneratorDescriptor &descriptor);
+
+        static void animate(entt::registry &registry, float delta_time);
+    };
+} // namespace hyper_engine
\ No newline at end of file
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include <entt/entt.hpp>
+
+#include <hyper_core/aabb_tree.hpp>
+
+namespace hyper_engine
+{
+    class TransformHierarchy;
+
+    // NOTE: Keeps an AabbTree over every entity with bounds and a world transform. Only entities whose world matrix changed during
+    //       the last hierarchy update are refitted, so static entities cost nothing per frame.
+    class SpatialIndex
+    {
+    public:
+        SpatialIndex(entt::registry &registry, const TransformHierarchy &transform_hierarchy);
+        ~SpatialIndex();
+
+        SpatialIndex(const SpatialIndex &) = delete;
+        SpatialIndex &operator=(const SpatialIndex &) = delete;
+
+        void update();
+
+        template <typename Shape, typename Function>
+        void query(const Shape &shape, Function function) const
+        {
+            m_tree.query(
+                shape,
+                [&function](const uint64_t user_data)
+                {
+                    return function(static_cast<entt::entity>(user_data));
+                });
+        }
+
+        template <typename Function>
+        void ray_cast(const Ray &ray, const float max_distance, Function function) const
+        {
+            m_tree.ray_cast(
+                ray,
+                max_distance,
+                [&function](const uint64_t user_data, const float distance)
+                {
+                    return function(static_cast<entt::entity>(user_data), distance);
+                });
+        }
+
+        template <typename Function>
+        void query_batch(const std::span<const BoundingBox> boxes, Function function) const
+        {
+            m_tree.query_batch(
+                boxes,
+                [&function](const uint32_t query_index, const uint64_t user_data)
+                {
+                    function(query_index, static_cast<entt::entity>(user_data));
+                });
+        }
+
+        const AabbTree &tree() const;
+
+    private:
+        void on_bounds_change(entt::registry &registry, entt::entity entity);
+        void on_bounds_destroy(entt::registry &registry, entt::entity entity);
+        void on_world_transform_destroy(entt::registry &registry, entt::entity entity);
+
+        void update_proxy(entt::entity entity);
+        void destroy_proxy(entt::entity entity);
+
+    private:
+        entt::registry &m_registry;
+        const TransformHierarchy &m_transform_hierarchy;
+
+        AabbTree m_tree;
+        std::unordered_map<entt::entity, int32_t> m_proxies;
+        std::vector<entt::entity> m_pending_entities;
+    };
+} // namespace hyper_engine
\ No newline at end of file
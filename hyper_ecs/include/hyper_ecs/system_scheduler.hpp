@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <entt/entt.hpp>
+
+#include <hyper_core/job_system.hpp>
+
+namespace hyper_engine
+{
+    template <typename... Components>
+    struct Read
+    {
+    };
+
+    template <typename... Components>
+    struct Write
+    {
+    };
+
+    // NOTE: Systems are ordered by their registration. A system only waits for earlier systems it conflicts with, which are
+    //       systems writing a component it accesses or accessing a component it writes. Systems in the same stage run in parallel
+    //       and must not create or destroy entities or components, structural changes belong into exclusive systems. Plain systems
+    //       always run on the calling thread, as patching a component fires the update signals of listeners that aren't thread-safe,
+    //       only the chunks of parallel systems are spread across the job system.
+    class SystemScheduler
+    {
+    public:
+        using SystemFunction = std::function<void(entt::registry &registry, float delta_time)>;
+
+        static constexpr uint32_t s_default_chunk_size = 256;
+
+    public:
+        template <typename ReadList, typename WriteList>
+        void add_system(std::string name, SystemFunction function)
+        {
+            System system = {
+                .name = std::move(name),
+                .run = std::move(function),
+            };
+            SystemScheduler::collect_access<ReadList, WriteList>(system);
+
+            add_system(std::move(system));
+        }
+
+        // NOTE: Runs the function for every entity of the view over all read and written components, split into chunks across the job system.
+        //       Workers write through plain references, so the written components are patched on the calling thread after the stage,
+        //       which fires the update signals the transform hierarchy and render object table listen to. Functions returning bool
+        //       only mark the entities they returned true for as written.
+        template <typename ReadList, typename WriteList, typename Function>
+        void add_parallel_system(std::string name, Function function, const uint32_t chunk_size = s_default_chunk_size)
+        {
+            System system = {
+                .name = std::move(name),
+                .chunk_size = std::max(chunk_size, 1u),
+            };
+            SystemScheduler::collect_access<ReadList, WriteList>(system);
+
+            system.gather = [](entt::registry &registry, std::vector<entt::entity> &entities)
+            {
+                const auto view = SystemScheduler::view(registry, ReadList{}, WriteList{});
+                entities.assign(view.begin(), view.end());
+            };
+            system.run_chunk = [function = std::move(function)](
+                                   entt::registry &registry,
+                                   const float delta_time,
+                                   const std::span<const entt::entity> entities,
+                                   const std::span<uint8_t> written)
+            {
+                const auto view = SystemScheduler::view(registry, ReadList{}, WriteList{});
+                for (size_t index = 0; index < entities.size(); ++index)
+                {
+                    const entt::entity entity = entities[index];
+                    std::apply(
+                        [&](auto &...components)
+                        {
+                            if constexpr (std::is_same_v<decltype(function(delta_time, entity, components...)), bool>)
+                            {
+                                written[index] = function(delta_time, entity, components...) ? 1 : 0;
+                            }
+                            else
+                            {
+                                function(delta_time, entity, components...);
+                                written[index] = 1;
+                            }
+                        },
+                        view.get(entity));
+                }
+            };
+            system.notify = [](entt::registry &registry, const std::span<const entt::entity> entities)
+            {
+                SystemScheduler::patch(registry, entities, WriteList{});
+            };
+
+            add_system(std::move(system));
+        }
+
+        void add_exclusive_system(std::string name, SystemFunction function)
+        {
+            add_system({
+                .name = std::move(name),
+                .run = std::move(function),
+                .exclusive = true,
+            });
+        }
+
+        void run(entt::registry &registry, const float delta_time)
+        {
+            if (m_dirty)
+            {
+                build_stages();
+            }
+
+            for (const std::vector<uint32_t> &stage : m_stages)
+            {
+                // NOTE: The views are gathered on the calling thread, as creating a view may create the storage of a component
+                for (const uint32_t system_index : stage)
+                {
+                    System &system = m_systems[system_index];
+                    if (system.gather)
+                    {
+                        system.gather(registry, system.entities);
+                        system.written.assign(system.entities.size(), 0);
+                    }
+                }
+
+                // NOTE: A stage with a single job runs inline, so only stages with actual parallelism pay for the job system
+                if (stage.size() == 1 && m_systems[stage.front()].entities.size() <= m_systems[stage.front()].chunk_size)
+                {
+                    SystemScheduler::run_system(m_systems[stage.front()], registry, delta_time);
+                    SystemScheduler::notify_written(m_systems[stage.front()], registry);
+                    continue;
+                }
+
+                JobContext context;
+                for (const uint32_t system_index : stage)
+                {
+                    System &system = m_systems[system_index];
+                    if (!system.run_chunk)
+                    {
+                        continue;
+                    }
+
+                    for (size_t offset = 0; offset < system.entities.size(); offset += system.chunk_size)
+                    {
+                        const size_t count = std::min<size_t>(system.chunk_size, system.entities.size() - offset);
+                        const std::span<const entt::entity> chunk(system.entities.data() + offset, count);
+                        const std::span<uint8_t> written(system.written.data() + offset, count);
+
+                        JobSystem::get()->execute(
+                            context,
+                            [&system, &registry, delta_time, chunk, written]()
+                            {
+                                system.run_chunk(registry, delta_time, chunk, written);
+                            });
+                    }
+                }
+
+                // NOTE: The plain systems overlap with the chunks of the parallel systems, which they don't conflict with
+                for (const uint32_t system_index : stage)
+                {
+                    System &system = m_systems[system_index];
+                    if (!system.run_chunk)
+                    {
+                        system.run(registry, delta_time);
+                    }
+                }
+
+                JobSystem::get()->wait(context);
+
+                for (const uint32_t system_index : stage)
+                {
+                    SystemScheduler::notify_written(m_systems[system_index], registry);
+                }
+            }
+        }
+
+        const std::vector<std::vector<uint32_t>> &stages()
+        {
+            if (m_dirty)
+            {
+                build_stages();
+            }
+
+            return m_stages;
+        }
+
+        const std::string &system_name(const uint32_t system_index) const
+        {
+            return m_systems[system_index].name;
+        }
+
+    private:
+        using GatherFunction = std::function<void(entt::registry &registry, std::vector<entt::entity> &entities)>;
+        using ChunkFunction =
+            std::function<void(entt::registry &registry, float delta_time, std::span<const entt::entity> entities, std::span<uint8_t> written)>;
+        using NotifyFunction = std::function<void(entt::registry &registry, std::span<const entt::entity> entities)>;
+
+        struct System
+        {
+            std::string name;
+            SystemFunction run;
+            bool exclusive = false;
+
+            GatherFunction gather;
+            ChunkFunction run_chunk;
+            NotifyFunction notify;
+            uint32_t chunk_size = 0;
+            std::vector<entt::entity> entities;
+            std::vector<uint8_t> written;
+
+            std::vector<entt::id_type> reads;
+            std::vector<entt::id_type> writes;
+        };
+
+    private:
+        static void run_system(System &system, entt::registry &registry, const float delta_time)
+        {
+            if (system.run_chunk)
+            {
+                system.run_chunk(registry, delta_time, system.entities, system.written);
+            }
+            else
+            {
+                system.run(registry, delta_time);
+            }
+        }
+
+        // NOTE: Compacts the entities down to the written ones, they are gathered again before the next run anyway
+        static void notify_written(System &system, entt::registry &registry)
+        {
+            if (!system.notify)
+            {
+                return;
+            }
+
+            size_t written_count = 0;
+            for (size_t index = 0; index < system.entities.size(); ++index)
+            {
+                if (system.written[index] != 0)
+                {
+                    system.entities[written_count++] = system.entities[index];
+                }
+            }
+
+            system.entities.resize(written_count);
+            system.notify(registry, system.entities);
+        }
+
+        template <typename... WriteComponents>
+        static void patch(entt::registry &registry, const std::span<const entt::entity> entities, Write<WriteComponents...>)
+        {
+            if constexpr (sizeof...(WriteComponents) > 0)
+            {
+                for (const entt::entity entity : entities)
+                {
+                    (registry.patch<WriteComponents>(entity), ...);
+                }
+            }
+        }
+
+        template <typename ReadList, typename WriteList>
+        static void collect_access(System &system)
+        {
+            SystemScheduler::collect_components(system.reads, ReadList{});
+            SystemScheduler::collect_components(system.writes, WriteList{});
+        }
+
+        template <template <typename...> typename List, typename... Components>
+        static void collect_components(std::vector<entt::id_type> &components, List<Components...>)
+        {
+            (components.push_back(entt::type_hash<std::remove_const_t<Components>>::value()), ...);
+        }
+
+        template <typename... ReadComponents, typename... WriteComponents>
+        static auto view(entt::registry &registry, Read<ReadComponents...>, Write<WriteComponents...>)
+        {
+            static_assert(sizeof...(ReadComponents) + sizeof...(WriteComponents) > 0, "Parallel systems need at least one component");
+            return registry.view<WriteComponents..., const ReadComponents...>();
+        }
+
+        static bool intersects(const std::vector<entt::id_type> &lhs, const std::vector<entt::id_type> &rhs)
+        {
+            return std::ranges::any_of(
+                lhs,
+                [&rhs](const entt::id_type component)
+                {
+                    return std::ranges::find(rhs, component) != rhs.end();
+                });
+        }
+
+        static bool conflicts(const System &lhs, const System &rhs)
+        {
+            if (lhs.exclusive || rhs.exclusive)
+            {
+                return true;
+            }
+
+            return SystemScheduler::intersects(lhs.writes, rhs.writes) || SystemScheduler::intersects(lhs.writes, rhs.reads) ||
+                   SystemScheduler::intersects(lhs.reads, rhs.writes);
+        }
+
+        void add_system(System system)
+        {
+            m_systems.push_back(std::move(system));
+            m_dirty = true;
+        }
+
+        // NOTE: Places every system one stage after the latest earlier system it depends on
+        void build_stages()
+        {
+            std::vector<uint32_t> system_stages(m_systems.size(), 0);
+            uint32_t stage_count = 0;
+
+            for (uint32_t system_index = 0; system_index < m_systems.size(); ++system_index)
+            {
+                uint32_t stage = 0;
+                for (uint32_t dependency_index = 0; dependency_index < system_index; ++dependency_index)
+                {
+                    if (SystemScheduler::conflicts(m_systems[dependency_index], m_systems[system_index]))
+                    {
+                        stage = std::max(stage, system_stages[dependency_index] + 1);
+                    }
+                }
+
+                system_stages[system_index] = stage;
+                stage_count = std::max(stage_count, stage + 1);
+            }
+
+            m_stages.assign(stage_count, {});
+            for (uint32_t system_index = 0; system_index < m_systems.size(); ++system_index)
+            {
+                m_stages[system_stages[system_index]].push_back(system_index);
+            }
+
+            m_dirty = false;
+        }
+
+    private:
+        std::vector<System> m_systems;
+        std::vector<std::vector<uint32_t>> m_stages;
+        bool m_dirty = false;
+    };
+} // namespace hyper_engine
\ No newline at end of file
@@ -10,9 +10,11 @@
 
 namespace hyper_engine
 {
+    // NOTE: The transform is relative to the parent, modify it through registry.patch or registry.replace to mark it dirty
     struct TransformComponent
     {
         glm::vec3 translation = {0.0f, 0.0f, 0.0f};
+        // NOTE: Euler angles in radians
         glm::vec3 rotation = {0.0f, 0.0f, 0.0f};
         glm::vec3 scale = {1.0f, 1.0f, 1.0f};
     };
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <entt/entt.hpp>
+
+#include <hyper_core/math.hpp>
+
+namespace hyper_engine
+{
+    // NOTE: Caches the world matrix of every entity with a transform. The matrices are stored as one array per column, with the
+    //       slots in depth first order, so every subtree is one contiguous range. Only the subtrees of changed transforms are
+    //       recomputed, disjoint subtrees in parallel.
+    class TransformHierarchy
+    {
+    public:
+        static constexpr uint32_t s_no_parent = std::numeric_limits<uint32_t>::max();
+        static constexpr uint32_t s_parallel_threshold = 1024;
+        static constexpr uint32_t s_group_size = 256;
+
+    public:
+        explicit TransformHierarchy(entt::registry &registry);
+        ~TransformHierarchy();
+
+        TransformHierarchy(const TransformHierarchy &) = delete;
+        TransformHierarchy &operator=(const TransformHierarchy &) = delete;
+
+        // NOTE: Returns false and keeps the old parent, if the new one would create a cycle
+        bool set_parent(entt::entity entity, entt::entity parent);
+
+        void update();
+
+        glm::mat4 world_matrix(entt::entity entity) const;
+        glm::mat4 world_matrix(uint32_t index) const;
+
+        // NOTE: The entities whose world matrix changed during the last update
+        const std::vector<entt::entity> &changed_entities() const;
+
+    private:
+        void on_structure_change(entt::registry &registry, entt::entity entity);
+        void on_transform_destroy(entt::registry &registry, entt::entity entity);
+        void on_transform_update(entt::registry &registry, entt::entity entity);
+
+        void rebuild();
+        void queue_slot(uint32_t index);
+        void update_range(uint32_t begin, uint32_t end);
+        void update_slot(uint32_t index);
+
+    private:
+        struct SlotRange
+        {
+            uint32_t begin = 0;
+            uint32_t end = 0;
+        };
+
+    private:
+        entt::registry &m_registry;
+
+        std::vector<entt::entity> m_entities;
+        std::vector<uint32_t> m_parents;
+        std::vector<uint32_t> m_subtree_sizes;
+        std::vector<uint8_t> m_queued;
+        std::vector<uint32_t> m_dirty_roots;
+        std::vector<SlotRange> m_dirty_ranges;
+        std::vector<entt::entity> m_pending_entities;
+        std::vector<entt::entity> m_changed_entities;
+        std::array<std::vector<glm::vec4>, 4> m_world_columns;
+
+        bool m_structure_dirty = true;
+    };
+} // namespace hyper_engine
\ No newline at end of file
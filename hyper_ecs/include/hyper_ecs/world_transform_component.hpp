@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace hyper_engine
+{
+    // NOTE: Managed by the TransformHierarchy, points to the slot of the cached world matrix
+    struct WorldTransformComponent
+    {
+        uint32_t index = 0;
+    };
+} // namespace hyper_engine
\ No newline at end of file
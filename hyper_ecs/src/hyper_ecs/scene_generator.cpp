@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_ecs/scene_generator.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <hyper_core/logger.hpp>
+
+#include "hyper_ecs/dynamic_component.hpp"
+#include "hyper_ecs/entity_batch.hpp"
+#include "hyper_ecs/hierarchy_component.hpp"
+#include "hyper_ecs/model_component.hpp"
+#include "hyper_ecs/transform_component.hpp"
+
+namespace hyper_engine
+{
+    static std::discrete_distribution<uint32_t> zipf_distribution(const uint32_t count, const float skew)
+    {
+        std::vector<double> weights(std::max(count, 1u));
+        for (size_t index = 0; index < weights.size(); ++index)
+        {
+            weights[index] = 1.0 / std::pow(static_cast<double>(index + 1), static_cast<double>(skew));
+        }
+
+        return std::discrete_distribution<uint32_t>(weights.begin(), weights.end());
+    }
+
+    void SceneGenerator::generate(entt::registry &registry, const SceneGeneratorDescriptor &descriptor)
+    {
+        const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+        const uint32_t entity_count = descriptor.entity_count;
+        const uint32_t chain_length = descriptor.hierarchy_depth + 1;
+        const uint32_t chain_count = (entity_count + chain_length - 1) / chain_length;
+        const uint32_t grid_size = std::max(static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<double>(chain_count)))), 1u);
+        const float grid_offset = static_cast<float>(grid_size) * descriptor.spacing * 0.5f;
+
+        const std::vector<entt::entity> entities =
+            create_entities<TransformComponent, HierarchyComponent, ModelComponent, DynamicComponent>(registry, entity_count);
+
+        std::mt19937 random(descriptor.seed);
+        std::discrete_distribution<uint32_t> model_distribution = zipf_distribution(descriptor.model_count, descriptor.variant_skew);
+        std::discrete_distribution<uint32_t> material_distribution = zipf_distribution(descriptor.material_count, descriptor.variant_skew);
+        std::bernoulli_distribution dynamic_distribution(std::clamp(descriptor.dynamic_fraction, 0.0f, 1.0f));
+        std::uniform_real_distribution<float> velocity_distribution(-1.0f, 1.0f);
+
+        std::vector<TransformComponent> transforms(entity_count);
+        std::vector<ModelComponent> models(entity_count);
+
+        std::vector<entt::entity> children;
+        std::vector<HierarchyComponent> hierarchies;
+        std::vector<entt::entity> dynamic_entities;
+        std::vector<DynamicComponent> dynamics;
+
+        for (uint32_t index = 0; index < entity_count; ++index)
+        {
+            const uint32_t chain = index / chain_length;
+            const uint32_t level = index % chain_length;
+
+            // NOTE: The roots are laid out on a grid, the children are stacked above their parents
+            if (level == 0)
+            {
+                transforms[index].translation = {
+                    static_cast<float>(chain % grid_size) * descriptor.spacing - grid_offset,
+                    0.0f,
+                    static_cast<float>(chain / grid_size) * descriptor.spacing - grid_offset,
+                };
+            }
+            else
+            {
+                transforms[index].translation = {0.0f, descriptor.spacing, 0.0f};
+
+                children.push_back(entities[index]);
+                hierarchies.push_back({
+                    .parent = entities[index - 1],
+                });
+            }
+
+            models[index] = {
+                .model = nullptr,
+                .model_index = model_distribution(random),
+                .material_index = material_distribution(random),
+            };
+
+            if (dynamic_distribution(random))
+            {
+                dynamic_entities.push_back(entities[index]);
+                dynamics.push_back({
+                    .angular_velocity = {0.0f, velocity_distribution(random), 0.0f},
+                });
+            }
+        }
+
+        registry.insert<TransformComponent>(entities.begin(), entities.end(), transforms.begin());
+        registry.insert<HierarchyComponent>(children.begin(), children.end(), hierarchies.begin());
+        registry.insert<ModelComponent>(entities.begin(), entities.end(), models.begin());
+        registry.insert<DynamicComponent>(dynamic_entities.begin(), dynamic_entities.end(), dynamics.begin());
+
+        const std::chrono::steady_clock::time_point end_time = std::chrono::steady_clock::now();
+        const std::chrono::duration<double, std::milli> elapsed_milliseconds = end_time - start_time;
+        HE_INFO(
+            "Generated scene with {} entities, {} of them dynamic, in {:.2f}ms",
+            entity_count,
+            dynamic_entities.size(),
+            elapsed_milliseconds.count());
+    }
+
+    void SceneGenerator::animate(entt::registry &registry, const float delta_time)
+    {
+        // NOTE: Patching marks the transforms dirty, so the hierarchy only recomputes the dynamic entities
+        const auto view = registry.view<const DynamicComponent, const TransformComponent>();
+        view.each(
+            [&registry, delta_time](const entt::entity entity, const DynamicComponent &dynamic, const TransformComponent &)
+            {
+                registry.patch<TransformComponent>(
+                    entity,
+                    [&dynamic, delta_time](TransformComponent &transform)
+                    {
+                        transform.rotation += dynamic.angular_velocity * delta_time;
+                    });
+            });
+    }
+} // namespace hyper_engine
\ No newline at end of file
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_ecs/spatial_index.hpp"
+
+#include <hyper_core/prerequisites.hpp>
+
+#include "hyper_ecs/bounds_component.hpp"
+#include "hyper_ecs/transform_hierarchy.hpp"
+#include "hyper_ecs/world_transform_component.hpp"
+
+namespace hyper_engine
+{
+    SpatialIndex::SpatialIndex(entt::registry &registry, const TransformHierarchy &transform_hierarchy)
+        : m_registry(registry)
+        , m_transform_hierarchy(transform_hierarchy)
+    {
+        m_registry.on_construct<BoundsComponent>().connect<&SpatialIndex::on_bounds_change>(this);
+        m_registry.on_update<BoundsComponent>().connect<&SpatialIndex::on_bounds_change>(this);
+        m_registry.on_destroy<BoundsComponent>().connect<&SpatialIndex::on_bounds_destroy>(this);
+        m_registry.on_destroy<WorldTransformComponent>().connect<&SpatialIndex::on_world_transform_destroy>(this);
+    }
+
+    SpatialIndex::~SpatialIndex()
+    {
+        m_registry.on_construct<BoundsComponent>().disconnect(this);
+        m_registry.on_update<BoundsComponent>().disconnect(this);
+        m_registry.on_destroy<BoundsComponent>().disconnect(this);
+        m_registry.on_destroy<WorldTransformComponent>().disconnect(this);
+    }
+
+    void SpatialIndex::update()
+    {
+        for (const entt::entity entity : m_pending_entities)
+        {
+            update_proxy(entity);
+        }
+        m_pending_entities.clear();
+
+        for (const entt::entity entity : m_transform_hierarchy.changed_entities())
+        {
+            update_proxy(entity);
+        }
+    }
+
+    const AabbTree &SpatialIndex::tree() const
+    {
+        return m_tree;
+    }
+
+    void SpatialIndex::on_bounds_change(entt::registry &registry, const entt::entity entity)
+    {
+        HE_UNUSED(registry);
+
+        m_pending_entities.push_back(entity);
+    }
+
+    void SpatialIndex::on_bounds_destroy(entt::registry &registry, const entt::entity entity)
+    {
+        HE_UNUSED(registry);
+
+        destroy_proxy(entity);
+    }
+
+    // NOTE: The proxy is created again, once the entity gets a transform and the hierarchy reports it as changed
+    void SpatialIndex::on_world_transform_destroy(entt::registry &registry, const entt::entity entity)
+    {
+        HE_UNUSED(registry);
+
+        destroy_proxy(entity);
+    }
+
+    void SpatialIndex::update_proxy(const entt::entity entity)
+    {
+        if (!m_registry.valid(entity))
+        {
+            return;
+        }
+
+        // NOTE: Entities without a world transform yet are picked up once the hierarchy reports them as changed
+        const BoundsComponent *bounds = m_registry.try_get<BoundsComponent>(entity);
+        const WorldTransformComponent *world_transform = m_registry.try_get<WorldTransformComponent>(entity);
+        if (bounds == nullptr || world_transform == nullptr)
+        {
+            return;
+        }
+
+        const BoundingBox box = bounds->box.transformed(m_transform_hierarchy.world_matrix(world_transform->index));
+
+        const auto proxy = m_proxies.find(entity);
+        if (proxy == m_proxies.end())
+        {
+            m_proxies.emplace(entity, m_tree.create_proxy(box, static_cast<uint64_t>(entity)));
+            return;
+        }
+
+        m_tree.move_proxy(proxy->second, box);
+    }
+
+    void SpatialIndex::destroy_proxy(const entt::entity entity)
+    {
+        const auto proxy = m_proxies.find(entity);
+        if (proxy == m_proxies.end())
+        {
+            return;
+        }
+
+        m_tree.destroy_proxy(proxy->second);
+        m_proxies.erase(proxy);
+    }
+} // namespace hyper_engine
\ No newline at end of file
@@ -0,0 +1,467 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_ecs/transform_hierarchy.hpp"
+
+#include <algorithm>
+
+#include <hyper_core/assertion.hpp>
+#include <hyper_core/job_system.hpp>
+#include <hyper_core/logger.hpp>
+#include <hyper_core/prerequisites.hpp>
+#include <hyper_core/simd.hpp>
+
+#include "hyper_ecs/hierarchy_component.hpp"
+#include "hyper_ecs/transform_component.hpp"
+#include "hyper_ecs/world_transform_component.hpp"
+
+namespace hyper_engine
+{
+    static glm::mat4 local_matrix(const TransformComponent &transform)
+    {
+        const glm::mat4 translation = glm::translate(glm::mat4(1.0f), transform.translation);
+        const glm::mat4 rotation = glm::mat4_cast(glm::quat(transform.rotation));
+        const glm::mat4 scale = glm::scale(glm::mat4(1.0f), transform.scale);
+
+        return translation * rotation * scale;
+    }
+
+    // NOTE: Every column of the result is a linear combination of the parent columns, weighted by the local column
+    static glm::vec4 multiply_column(const std::array<glm::vec4, 4> &parent, const glm::vec4 &local)
+    {
+#if HE_SIMD_SSE
+        __m128 result = _mm_mul_ps(_mm_loadu_ps(&parent[0].x), _mm_set1_ps(local.x));
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_loadu_ps(&parent[1].x), _mm_set1_ps(local.y)));
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_loadu_ps(&parent[2].x), _mm_set1_ps(local.z)));
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_loadu_ps(&parent[3].x), _mm_set1_ps(local.w)));
+
+        glm::vec4 column;
+        _mm_storeu_ps(&column.x, result);
+        return column;
+#else
+        return parent[0] * local.x + parent[1] * local.y + parent[2] * local.z + parent[3] * local.w;
+#endif
+    }
+
+    TransformHierarchy::TransformHierarchy(entt::registry &registry)
+        : m_registry(registry)
+    {
+        m_registry.on_construct<TransformComponent>().connect<&TransformHierarchy::on_structure_change>(this);
+        m_registry.on_destroy<TransformComponent>().connect<&TransformHierarchy::on_transform_destroy>(this);
+        m_registry.on_update<TransformComponent>().connect<&TransformHierarchy::on_transform_update>(this);
+
+        m_registry.on_construct<HierarchyComponent>().connect<&TransformHierarchy::on_structure_change>(this);
+        m_registry.on_destroy<HierarchyComponent>().connect<&TransformHierarchy::on_structure_change>(this);
+        m_registry.on_update<HierarchyComponent>().connect<&TransformHierarchy::on_structure_change>(this);
+    }
+
+    TransformHierarchy::~TransformHierarchy()
+    {
+        m_registry.on_construct<TransformComponent>().disconnect(this);
+        m_registry.on_destroy<TransformComponent>().disconnect(this);
+        m_registry.on_update<TransformComponent>().disconnect(this);
+
+        m_registry.on_construct<HierarchyComponent>().disconnect(this);
+        m_registry.on_destroy<HierarchyComponent>().disconnect(this);
+        m_registry.on_update<HierarchyComponent>().disconnect(this);
+    }
+
+    bool TransformHierarchy::set_parent(const entt::entity entity, const entt::entity parent)
+    {
+        // NOTE: The walk is bounded, so cycles created through the registry directly can't hang the check
+        const size_t max_depth = m_registry.storage<HierarchyComponent>().size();
+
+        entt::entity ancestor = parent;
+        for (size_t depth = 0; ancestor != entt::null && depth <= max_depth; ++depth)
+        {
+            if (ancestor == entity)
+            {
+                HE_ERROR("Failed to set the parent of entity {}: The hierarchy would contain a cycle", static_cast<uint32_t>(entity));
+                return false;
+            }
+
+            const HierarchyComponent *hierarchy = m_registry.try_get<HierarchyComponent>(ancestor);
+            ancestor = hierarchy != nullptr ? hierarchy->parent : entt::null;
+        }
+
+        m_registry.emplace_or_replace<HierarchyComponent>(entity, parent);
+        return true;
+    }
+
+    void TransformHierarchy::update()
+    {
+        m_changed_entities.clear();
+
+        if (m_structure_dirty)
+        {
+            rebuild();
+        }
+
+        // NOTE: Static scenes end here, as nothing has to be recomputed
+        if (m_dirty_roots.empty())
+        {
+            return;
+        }
+
+        // NOTE: Sorted roots visit ancestors first, so roots inside of an already dirty subtree are skipped
+        std::ranges::sort(m_dirty_roots);
+
+        m_dirty_ranges.clear();
+        uint32_t dirty_count = 0;
+        for (const uint32_t root : m_dirty_roots)
+        {
+            m_queued[root] = 0;
+            if (!m_dirty_ranges.empty() && root < m_dirty_ranges.back().end)
+            {
+                continue;
+            }
+
+            m_dirty_ranges.push_back({
+                .begin = root,
+                .end = root + m_subtree_sizes[root],
+            });
+            dirty_count += m_subtree_sizes[root];
+        }
+        m_dirty_roots.clear();
+
+        const uint32_t range_count = static_cast<uint32_t>(m_dirty_ranges.size());
+        if (dirty_count < s_parallel_threshold || range_count == 1)
+        {
+            for (const SlotRange &range : m_dirty_ranges)
+            {
+                update_range(range.begin, range.end);
+            }
+        }
+        else
+        {
+            // NOTE: The subtrees are disjoint, groups cover roughly the same number of slots
+            const uint32_t group_size = std::max<uint32_t>(1, static_cast<uint32_t>(uint64_t{s_group_size} * range_count / dirty_count));
+            JobContext context;
+            JobSystem::get()->dispatch(
+                context,
+                range_count,
+                group_size,
+                [this](const DispatchArgs args)
+                {
+                    const SlotRange &range = m_dirty_ranges[args.job_index];
+                    update_range(range.begin, range.end);
+                });
+            JobSystem::get()->wait(context);
+        }
+
+        m_changed_entities.reserve(dirty_count);
+        for (const SlotRange &range : m_dirty_ranges)
+        {
+            m_changed_entities.insert(m_changed_entities.end(), m_entities.begin() + range.begin, m_entities.begin() + range.end);
+        }
+    }
+
+    glm::mat4 TransformHierarchy::world_matrix(const entt::entity entity) const
+    {
+        const WorldTransformComponent *world_transform = m_registry.try_get<WorldTransformComponent>(entity);
+        if (m_structure_dirty || world_transform == nullptr)
+        {
+            return glm::mat4(1.0f);
+        }
+
+        return world_matrix(world_transform->index);
+    }
+
+    glm::mat4 TransformHierarchy::world_matrix(const uint32_t index) const
+    {
+        HE_ASSERT(index < m_entities.size());
+
+        return {
+            m_world_columns[0][index],
+            m_world_columns[1][index],
+            m_world_columns[2][index],
+            m_world_columns[3][index],
+        };
+    }
+
+    const std::vector<entt::entity> &TransformHierarchy::changed_entities() const
+    {
+        return m_changed_entities;
+    }
+
+    void TransformHierarchy::on_structure_change(entt::registry &registry, const entt::entity entity)
+    {
+        HE_UNUSED(registry);
+        HE_UNUSED(entity);
+
+        m_structure_dirty = true;
+    }
+
+    // NOTE: The world transform goes with the transform, so no one reads the slot of an entity that left the hierarchy
+    void TransformHierarchy::on_transform_destroy(entt::registry &registry, const entt::entity entity)
+    {
+        registry.remove<WorldTransformComponent>(entity);
+
+        m_structure_dirty = true;
+    }
+
+    void TransformHierarchy::on_transform_update(entt::registry &registry, const entt::entity entity)
+    {
+        // NOTE: The slots are reassigned by the next rebuild, so the entity is remembered instead
+        if (m_structure_dirty)
+        {
+            m_pending_entities.push_back(entity);
+            return;
+        }
+
+        if (const WorldTransformComponent *world_transform = registry.try_get<WorldTransformComponent>(entity))
+        {
+            queue_slot(world_transform->index);
+        }
+    }
+
+    void TransformHierarchy::rebuild()
+    {
+        const std::vector<entt::entity> old_entities = std::move(m_entities);
+        const std::vector<uint32_t> old_parents = std::move(m_parents);
+        const std::array<std::vector<glm::vec4>, 4> old_world_columns = std::move(m_world_columns);
+
+        for (const uint32_t root : m_dirty_roots)
+        {
+            m_pending_entities.push_back(old_entities[root]);
+        }
+        m_dirty_roots.clear();
+
+        const auto view = m_registry.view<const TransformComponent>();
+        const std::vector<entt::entity> entities(view.begin(), view.end());
+        const uint32_t entity_count = static_cast<uint32_t>(entities.size());
+
+        // NOTE: The world transform components temporarily store the index into the gathered entities, only new entities get one
+        //       emplaced. The previous slot is kept, if it still belongs to the same entity.
+        std::vector<uint32_t> old_slots(entity_count, s_no_parent);
+        for (uint32_t index = 0; index < entity_count; ++index)
+        {
+            WorldTransformComponent *world_transform = m_registry.try_get<WorldTransformComponent>(entities[index]);
+            if (world_transform == nullptr)
+            {
+                m_registry.emplace<WorldTransformComponent>(entities[index], index);
+                continue;
+            }
+
+            if (world_transform->index < old_entities.size() && old_entities[world_transform->index] == entities[index])
+            {
+                old_slots[index] = world_transform->index;
+            }
+
+            world_transform->index = index;
+        }
+
+        const auto parent_of = [this](const entt::entity entity)
+        {
+            const HierarchyComponent *hierarchy = m_registry.try_get<HierarchyComponent>(entity);
+            if (hierarchy == nullptr || !m_registry.valid(hierarchy->parent) || !m_registry.all_of<TransformComponent>(hierarchy->parent))
+            {
+                return entt::entity(entt::null);
+            }
+
+            return hierarchy->parent;
+        };
+
+        std::vector<uint32_t> parents(entity_count, s_no_parent);
+        std::vector<uint32_t> child_offsets(entity_count + 1, 0);
+        for (uint32_t index = 0; index < entity_count; ++index)
+        {
+            const entt::entity parent = parent_of(entities[index]);
+            if (parent != entt::null)
+            {
+                parents[index] = m_registry.get<WorldTransformComponent>(parent).index;
+                child_offsets[parents[index] + 1] += 1;
+            }
+        }
+
+        for (uint32_t index = 0; index < entity_count; ++index)
+        {
+            child_offsets[index + 1] += child_offsets[index];
+        }
+
+        std::vector<uint32_t> children(child_offsets.back());
+        std::vector<uint32_t> child_counts(entity_count, 0);
+        for (uint32_t index = 0; index < entity_count; ++index)
+        {
+            if (parents[index] != s_no_parent)
+            {
+                children[child_offsets[parents[index]] + child_counts[parents[index]]++] = index;
+            }
+        }
+
+        // NOTE: Entities that can't be reached from a root are part of a cycle or below one
+        std::vector<uint32_t> order;
+        order.reserve(entity_count);
+        std::vector<uint8_t> visited(entity_count, 0);
+        std::vector<uint32_t> stack;
+        const auto visit_subtree = [&](const uint32_t root)
+        {
+            stack.push_back(root);
+            visited[root] = 1;
+            while (!stack.empty())
+            {
+                const uint32_t index = stack.back();
+                stack.pop_back();
+                order.push_back(index);
+
+                // NOTE: Pushed in reverse, so the children keep their order
+                for (uint32_t child = child_offsets[index + 1]; child > child_offsets[index]; --child)
+                {
+                    const uint32_t child_index = children[child - 1];
+                    if (visited[child_index] == 0)
+                    {
+                        visited[child_index] = 1;
+                        stack.push_back(child_index);
+                    }
+                }
+            }
+        };
+
+        for (uint32_t index = 0; index < entity_count; ++index)
+        {
+            if (parents[index] == s_no_parent)
+            {
+                visit_subtree(index);
+            }
+        }
+
+        std::vector<uint32_t> walk_stamps(entity_count, s_no_parent);
+        for (uint32_t index = 0; index < entity_count; ++index)
+        {
+            if (visited[index] != 0)
+            {
+                continue;
+            }
+
+            // NOTE: Walks up until an entity repeats, which lies on the cycle, and breaks the cycle there
+            uint32_t cycle_index = index;
+            while (walk_stamps[cycle_index] != index)
+            {
+                walk_stamps[cycle_index] = index;
+                cycle_index = parents[cycle_index];
+            }
+
+            HE_WARN("The transform hierarchy contains a cycle, entity {} is treated as a root", static_cast<uint32_t>(entities[cycle_index]));
+            parents[cycle_index] = s_no_parent;
+            visit_subtree(cycle_index);
+        }
+
+        std::vector<uint32_t> slots(entity_count);
+        for (uint32_t slot = 0; slot < entity_count; ++slot)
+        {
+            slots[order[slot]] = slot;
+        }
+
+        m_entities.resize(entity_count);
+        m_parents.resize(entity_count);
+        for (uint32_t slot = 0; slot < entity_count; ++slot)
+        {
+            const uint32_t index = order[slot];
+            m_entities[slot] = entities[index];
+            m_parents[slot] = parents[index] != s_no_parent ? slots[parents[index]] : s_no_parent;
+            m_registry.get<WorldTransformComponent>(entities[index]).index = slot;
+        }
+
+        // NOTE: Parents precede their children in depth first order, so the sizes are accumulated backwards
+        m_subtree_sizes.assign(entity_count, 1);
+        for (uint32_t slot = entity_count; slot-- > 0;)
+        {
+            if (m_parents[slot] != s_no_parent)
+            {
+                m_subtree_sizes[m_parents[slot]] += m_subtree_sizes[slot];
+            }
+        }
+
+        for (std::vector<glm::vec4> &column : m_world_columns)
+        {
+            column.resize(entity_count);
+        }
+
+        m_queued.assign(entity_count, 0);
+
+        // NOTE: Matrices of entities with the same parent as before are carried over, everything else is recomputed
+        for (uint32_t slot = 0; slot < entity_count; ++slot)
+        {
+            const uint32_t old_slot = old_slots[order[slot]];
+            const entt::entity parent = m_parents[slot] != s_no_parent ? m_entities[m_parents[slot]] : entt::null;
+            const entt::entity old_parent =
+                old_slot != s_no_parent && old_parents[old_slot] != s_no_parent ? old_entities[old_parents[old_slot]] : entt::null;
+
+            if (old_slot == s_no_parent || parent != old_parent)
+            {
+                queue_slot(slot);
+                continue;
+            }
+
+            for (size_t column = 0; column < m_world_columns.size(); ++column)
+            {
+                m_world_columns[column][slot] = old_world_columns[column][old_slot];
+            }
+        }
+
+        for (const entt::entity entity : m_pending_entities)
+        {
+            if (!m_registry.valid(entity))
+            {
+                continue;
+            }
+
+            if (const WorldTransformComponent *world_transform = m_registry.try_get<WorldTransformComponent>(entity))
+            {
+                queue_slot(world_transform->index);
+            }
+        }
+        m_pending_entities.clear();
+
+        m_structure_dirty = false;
+    }
+
+    void TransformHierarchy::queue_slot(const uint32_t index)
+    {
+        if (m_queued[index] != 0)
+        {
+            return;
+        }
+
+        m_queued[index] = 1;
+        m_dirty_roots.push_back(index);
+    }
+
+    void TransformHierarchy::update_range(const uint32_t begin, const uint32_t end)
+    {
+        for (uint32_t index = begin; index < end; ++index)
+        {
+            update_slot(index);
+        }
+    }
+
+    void TransformHierarchy::update_slot(const uint32_t index)
+    {
+        const uint32_t parent = m_parents[index];
+        const glm::mat4 local = local_matrix(m_registry.get<TransformComponent>(m_entities[index]));
+        if (parent == s_no_parent)
+        {
+            for (size_t column = 0; column < m_world_columns.size(); ++column)
+            {
+                m_world_columns[column][index] = local[static_cast<glm::length_t>(column)];
+            }
+
+            return;
+        }
+
+        const std::array<glm::vec4, 4> parent_columns = {
+            m_world_columns[0][parent],
+            m_world_columns[1][parent],
+            m_world_columns[2][parent],
+            m_world_columns[3][parent],
+        };
+
+        for (size_t column = 0; column < m_world_columns.size(); ++column)
+        {
+            m_world_columns[column][index] = multiply_column(parent_columns, local[static_cast<glm::length_t>(column)]);
+        }
+    }
+} // namespace hyper_engine
\ No newline at end of file
@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <vector>
+
+#include <hyper_event/subscription_handle.hpp>
 #include <hyper_platform/forward.hpp>
 
 #include "hyper_engine/camera.hpp"
@@ -15,6 +18,10 @@ namespace hyper_engine
 {
     class EditorEngine final : public Engine
     {
+    public:
+        static constexpr const char *s_scene_path = "./assets/scenes/editor.hescene";
+        static constexpr const char *s_scene_text_path = "./assets/scenes/editor.hescene.txt";
+
     public:
         bool initialize() override;
         void shutdown() override;
@@ -26,11 +33,17 @@ namespace hyper_engine
         const Camera &camera() const override;
 
     private:
+        void create_default_scene();
+        void save_scene();
+
         void on_resize(const WindowResizeEvent &event);
+        void on_key_press(const KeyPressEvent &event);
         void on_mouse_move(const MouseMoveEvent &event);
         void on_mouse_scroll(const MouseScrollEvent &event);
 
     private:
         Camera m_camera = Camera(glm::vec3(0.0f, 2.0f, 0.0f), -90.0f, 0.0f);
+
+        std::vector<SubscriptionHandle> m_subscriptions;
     };
 } // namespace hyper_engine
\ No newline at end of file
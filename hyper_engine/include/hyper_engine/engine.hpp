@@ -6,6 +6,10 @@
 
 #pragma once
 
+#include <optional>
+
+#include <hyper_ecs/scene_generator.hpp>
+#include <hyper_ecs/system_scheduler.hpp>
 #include <hyper_render/scene.hpp>
 
 namespace hyper_engine
@@ -27,9 +31,20 @@ namespace hyper_engine
         // FIXME: This should be done better somehow
         virtual const Camera &camera() const = 0;
 
+        void run_fixed_update_systems(float delta_time);
+        void run_update_systems(float delta_time);
+
+        // NOTE: Replaces the scene the engine would load with a generated one, has to be set before initializing
+        void set_generated_scene(const SceneGeneratorDescriptor &descriptor);
+
+        Scene &scene();
         const Scene &scene() const;
 
     protected:
         Scene m_scene;
+        std::optional<SceneGeneratorDescriptor> m_generated_scene;
+
+        SystemScheduler m_fixed_update_systems;
+        SystemScheduler m_update_systems;
     };
 } // namespace hyper_engine
\ No newline at end of file
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <hyper_core/own_ptr.hpp>
+#include <hyper_ecs/scene_generator.hpp>
 #include <hyper_platform/forward.hpp>
 
 namespace hyper_engine
@@ -29,6 +30,7 @@ namespace hyper_engine
 
     private:
         bool m_editor_enabled = false;
+        SceneGeneratorDescriptor m_scene_generator_descriptor;
         OwnPtr<Engine> m_engine;
         bool m_exit_requested = false;
     };
@@ -6,37 +6,38 @@
 
 #include "hyper_engine/editor_engine.hpp"
 
+#include <filesystem>
+
+#include <hyper_core/logger.hpp>
 #include <hyper_core/prerequisites.hpp>
+#include <hyper_ecs/dynamic_component.hpp>
 #include <hyper_ecs/model_component.hpp>
 #include <hyper_ecs/transform_component.hpp>
 #include <hyper_event/event_bus.hpp>
 #include <hyper_platform/input.hpp>
+#include <hyper_platform/key_events.hpp>
 #include <hyper_platform/mouse_events.hpp>
 #include <hyper_platform/window_events.hpp>
+#include <hyper_render/scene_serializer.hpp>
 
 namespace hyper_engine
 {
     bool EditorEngine::initialize()
     {
-        EventBus::get()->subscribe<WindowResizeEvent>(HE_BIND_FUNCTION(EditorEngine::on_resize));
-        EventBus::get()->subscribe<MouseMoveEvent>(HE_BIND_FUNCTION(EditorEngine::on_mouse_move));
-        EventBus::get()->subscribe<MouseScrollEvent>(HE_BIND_FUNCTION(EditorEngine::on_mouse_scroll));
+        m_subscriptions.push_back(EventBus::get()->subscribe<WindowResizeEvent, &EditorEngine::on_resize>(this));
+        m_subscriptions.push_back(EventBus::get()->subscribe<KeyPressEvent, &EditorEngine::on_key_press>(this));
+        m_subscriptions.push_back(EventBus::get()->subscribe<MouseMoveEvent, &EditorEngine::on_mouse_move>(this));
+        m_subscriptions.push_back(EventBus::get()->subscribe<MouseScrollEvent, &EditorEngine::on_mouse_scroll>(this));
 
-        // FIXME: The editor shouldn't create entities on its own. Replace this after implementing project files
-        entt::registry &registry = m_scene.registry();
-        for (int32_t z = -10; z != 10; ++z)
+        if (m_generated_scene)
         {
-            for (int32_t x = -10; x != 10; ++x)
-            {
-                const entt::entity entity = registry.create();
-                registry.emplace<TransformComponent>(
-                    entity,
-                    glm::vec3{static_cast<float>(x) * 2.0f, 1.0f, static_cast<float>(z) * 2.0f},
-                    glm::vec3{0.0f, 0.0f, 0.0f},
-                    glm::vec3{1.0f, 1.0f, 1.0f});
-                // FIXME: Don't hardcode the model
-                registry.emplace<ModelComponent>(entity, nullptr);
-            }
+            SceneGenerator::generate(m_scene.registry(), *m_generated_scene);
+
+            m_update_systems.add_system<Read<DynamicComponent>, Write<TransformComponent>>("animate_dynamic_entities", &SceneGenerator::animate);
+        }
+        else if (!std::filesystem::exists(s_scene_path) || !SceneSerializer::load(m_scene, s_scene_path))
+        {
+            create_default_scene();
         }
 
         // FIXME: Enable grid and gui
@@ -46,7 +47,12 @@ namespace hyper_engine
 
     void EditorEngine::shutdown()
     {
-        // FIXME: Unsubscribe event listeners
+        for (SubscriptionHandle &subscription : m_subscriptions)
+        {
+            EventBus::get()->unsubscribe(subscription);
+        }
+
+        m_subscriptions.clear();
     }
 
     void EditorEngine::fixed_update(const float delta_time, const float total_time)
@@ -91,11 +97,59 @@ namespace hyper_engine
         return m_camera;
     }
 
+    void EditorEngine::create_default_scene()
+    {
+        // FIXME: The editor shouldn't create entities on its own. Remove this once scenes can be edited
+        entt::registry &registry = m_scene.registry();
+        for (int32_t z = -10; z != 10; ++z)
+        {
+            for (int32_t x = -10; x != 10; ++x)
+            {
+                const entt::entity entity = registry.create();
+                registry.emplace<TransformComponent>(
+                    entity,
+                    glm::vec3{static_cast<float>(x) * 2.0f, 1.0f, static_cast<float>(z) * 2.0f},
+                    glm::vec3{0.0f, 0.0f, 0.0f},
+                    glm::vec3{1.0f, 1.0f, 1.0f});
+                // FIXME: Don't hardcode the model
+                registry.emplace<ModelComponent>(entity, nullptr);
+            }
+        }
+    }
+
+    void EditorEngine::save_scene()
+    {
+        // NOTE: Generated scenes are benchmark workloads and must not overwrite the editor scene
+        if (m_generated_scene)
+        {
+            HE_WARN("Generated scenes can't be saved");
+            return;
+        }
+
+        // NOTE: The text export is only written for reviewing changes of the scene in diffs
+        std::error_code error_code;
+        std::filesystem::create_directories(std::filesystem::path(s_scene_path).parent_path(), error_code);
+        if (SceneSerializer::save(m_scene, s_scene_path))
+        {
+            SceneSerializer::export_text(m_scene, s_scene_text_path);
+            HE_INFO("Saved scene '{}'", s_scene_path);
+        }
+    }
+
     void EditorEngine::on_resize(const WindowResizeEvent &event)
     {
         m_camera.set_aspect_ratio(static_cast<float>(event.width()) / static_cast<float>(event.height()));
     }
 
+    void EditorEngine::on_key_press(const KeyPressEvent &event)
+    {
+        const bool control_pressed = Input::get()->is_key_pressed(KeyCode::LCtrl) || Input::get()->is_key_pressed(KeyCode::RCtrl);
+        if (event.key_code() == KeyCode::S && control_pressed)
+        {
+            save_scene();
+        }
+    }
+
     void EditorEngine::on_mouse_move(const MouseMoveEvent &event)
     {
         m_camera.process_mouse_movement(event.x(), event.y());
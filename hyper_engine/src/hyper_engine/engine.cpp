@@ -8,6 +8,29 @@
 
 namespace hyper_engine
 {
+    void Engine::run_fixed_update_systems(const float delta_time)
+    {
+        m_fixed_update_systems.run(m_scene.registry(), delta_time);
+    }
+
+    void Engine::run_update_systems(const float delta_time)
+    {
+        m_update_systems.run(m_scene.registry(), delta_time);
+
+        // NOTE: Recomputes the world matrices once per frame, after every system had the chance to move entities
+        m_scene.update();
+    }
+
+    void Engine::set_generated_scene(const SceneGeneratorDescriptor &descriptor)
+    {
+        m_generated_scene = descriptor;
+    }
+
+    Scene &Engine::scene()
+    {
+        return m_scene;
+    }
+
     const Scene &Engine::scene() const
     {
         return m_scene;
@@ -6,6 +6,7 @@
 
 #include "hyper_engine/engine_loop.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
 #include <ranges>
@@ -15,8 +16,10 @@
 #include <argparse/argparse.hpp>
 
 #include <hyper_core/assertion.hpp>
+#include <hyper_core/flight_recorder.hpp>
 #include <hyper_core/job_system.hpp>
 #include <hyper_core/logger.hpp>
+#include <hyper_core/metrics.hpp>
 #include <hyper_core/prerequisites.hpp>
 #include <hyper_event/event_bus.hpp>
 #include <hyper_platform/input.hpp>
@@ -30,18 +33,36 @@
 
 namespace hyper_engine
 {
+    static float elapsed_milliseconds(std::chrono::steady_clock::time_point &start_time)
+    {
+        const std::chrono::steady_clock::time_point end_time = std::chrono::steady_clock::now();
+        const float elapsed_time = std::chrono::duration<float, std::milli>(end_time - start_time).count();
+        start_time = end_time;
+        return elapsed_time;
+    }
+
     EngineLoop::EngineLoop()
     {
     }
 
     EngineLoop::~EngineLoop()
     {
+        if (m_engine)
+        {
+            m_engine->shutdown();
+        }
+
+        // NOTE: The scene holds render objects referencing GPU buffers, so it has to be gone before the device is deleted
+        m_engine.reset();
+
         delete Renderer::get();
         delete GraphicsDevice::get();
         delete Window::get();
         delete Input::get();
         delete EventBus::get();
         delete JobSystem::get();
+        delete MetricsRegistry::get();
+        delete FlightRecorder::get();
         delete Logger::get();
     }
 
@@ -50,6 +71,8 @@ namespace hyper_engine
         const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
 
         Logger::get() = new Logger();
+        FlightRecorder::get() = new FlightRecorder();
+        MetricsRegistry::get() = new MetricsRegistry();
         JobSystem::get() = new JobSystem();
 
         const std::vector<std::string> arguments(argv, argv + argc);
@@ -76,6 +99,36 @@ namespace hyper_engine
         bool debug_marker_enabled = false;
         program.add_argument("--debug-marker").default_value(false).implicit_value(true).store_into(debug_marker_enabled);
 
+        bool gpu_driven_enabled = false;
+        program.add_argument("--gpu-driven").default_value(false).implicit_value(true).store_into(gpu_driven_enabled);
+
+        std::string metrics_file;
+        program.add_argument("--metrics-file").default_value("").store_into(metrics_file);
+
+        int32_t metrics_interval = 1000;
+        program.add_argument("--metrics-interval").default_value(1000).store_into(metrics_interval);
+
+        int32_t stress_entities = 0;
+        program.add_argument("--stress-entities").default_value(0).store_into(stress_entities);
+
+        int32_t stress_models = 1;
+        program.add_argument("--stress-models").default_value(1).store_into(stress_models);
+
+        int32_t stress_materials = 1;
+        program.add_argument("--stress-materials").default_value(1).store_into(stress_materials);
+
+        double stress_skew = 0.0;
+        program.add_argument("--stress-skew").default_value(0.0).store_into(stress_skew);
+
+        int32_t stress_depth = 0;
+        program.add_argument("--stress-depth").default_value(0).store_into(stress_depth);
+
+        double stress_dynamic = 0.0;
+        program.add_argument("--stress-dynamic").default_value(0.0).store_into(stress_dynamic);
+
+        int32_t stress_seed = 0;
+        program.add_argument("--stress-seed").default_value(0).store_into(stress_seed);
+
         try
         {
             program.parse_args(arguments);
@@ -123,6 +176,19 @@ namespace hyper_engine
 
         Logger::get()->set_level(level);
 
+        MetricsRegistry::get()->set_export(metrics_file, std::chrono::milliseconds(metrics_interval));
+
+        m_scene_generator_descriptor = {
+            .entity_count = static_cast<uint32_t>(std::max(stress_entities, 0)),
+            .model_count = static_cast<uint32_t>(std::max(stress_models, 1)),
+            .material_count = static_cast<uint32_t>(std::max(stress_materials, 1)),
+            .variant_skew = static_cast<float>(stress_skew),
+            .hierarchy_depth = static_cast<uint32_t>(std::max(stress_depth, 0)),
+            .dynamic_fraction = static_cast<float>(stress_dynamic),
+            .spacing = 2.0f,
+            .seed = static_cast<uint32_t>(stress_seed),
+        };
+
         EventBus::get() = new EventBus();
         Input::get() = new Input();
         Window::get() = new Window({
@@ -153,9 +219,13 @@ namespace hyper_engine
             .debug_marker = debug_marker_enabled,
         });
 
-        Renderer::get() = new Renderer();
+        Renderer::get() = new Renderer({
+            .model_count = m_scene_generator_descriptor.model_count,
+            .material_count = m_scene_generator_descriptor.material_count,
+        });
+        Renderer::get()->set_gpu_driven(gpu_driven_enabled);
 
-        EventBus::get()->subscribe<WindowCloseEvent>(HE_BIND_FUNCTION(EngineLoop::on_close));
+        EventBus::get()->subscribe<WindowCloseEvent, &EngineLoop::on_close>(this);
 
         const std::chrono::steady_clock::time_point end_time = std::chrono::steady_clock::now();
         const std::chrono::duration<double> elapsed_seconds = end_time - start_time;
@@ -177,6 +247,11 @@ namespace hyper_engine
             m_engine = make_own<GameEngine>();
         }
 
+        if (m_scene_generator_descriptor.entity_count > 0)
+        {
+            m_engine->set_generated_scene(m_scene_generator_descriptor);
+        }
+
         if (!m_engine->initialize())
         {
             HE_CRITICAL("Failed to initialize the engine!");
@@ -197,15 +272,24 @@ namespace hyper_engine
 
         float accumulator = 0.0;
         std::chrono::time_point current_time = std::chrono::steady_clock::now();
+
+        Histogram &frame_time_histogram = MetricsRegistry::get()->histogram("engine.frame_time_us");
+        uint64_t frame_index = 0;
         while (!m_exit_requested)
         {
+            FlightRecorder::get()->begin_frame(frame_index);
+
             // Update frame time
             const std::chrono::time_point new_time = std::chrono::steady_clock::now();
             const float frame_time = std::chrono::duration<float>(new_time - current_time).count();
             current_time = new_time;
 
+            frame_time_histogram.record(static_cast<uint64_t>(frame_time * 1000.0f * 1000.0f));
+
             accumulator += frame_time;
 
+            std::chrono::steady_clock::time_point phase_time = std::chrono::steady_clock::now();
+
             // Handle Events
             Window::get()->process_events();
             while (Window::get()->width() == 0 || Window::get()->height() == 0)
@@ -213,17 +297,28 @@ namespace hyper_engine
                 Window::wait_events();
             }
 
+            EventBus::get()->drain_posted_events();
+            EventBus::get()->flush();
+
+            FlightRecorder::get()->record_phase(FramePhase::Events, elapsed_milliseconds(phase_time));
+
             while (accumulator >= delta_time)
             {
                 // Fixed Update
                 m_engine->fixed_update(delta_time, total_time);
+                m_engine->run_fixed_update_systems(delta_time);
 
                 accumulator -= delta_time;
                 total_time += delta_time;
             }
 
+            FlightRecorder::get()->record_phase(FramePhase::FixedUpdate, elapsed_milliseconds(phase_time));
+
             // Update
             m_engine->update(delta_time, total_time);
+            m_engine->run_update_systems(delta_time);
+
+            FlightRecorder::get()->record_phase(FramePhase::Update, elapsed_milliseconds(phase_time));
 
             // Render
             const Camera &camera = m_engine->camera();
@@ -239,7 +334,18 @@ namespace hyper_engine
             m_engine->render();
 
             Renderer::get()->end_frame();
+
+            FlightRecorder::get()->record_phase(FramePhase::Render, elapsed_milliseconds(phase_time));
+
             Renderer::get()->present();
+
+            FlightRecorder::get()->record_phase(FramePhase::Present, elapsed_milliseconds(phase_time));
+            FlightRecorder::get()->end_frame();
+
+            // Metrics
+            MetricsRegistry::get()->update();
+
+            frame_index += 1;
         }
     }
 
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <functional>
+#include <utility>
+
+namespace hyper_engine
+{
+    template <typename>
+    class Delegate;
+
+    // NOTE: A non-owning function pointer and context pair, which doesn't allocate like std::function does
+    template <typename R, typename... Args>
+    class Delegate<R(Args...)>
+    {
+    public:
+        template <auto Function>
+        static Delegate create()
+        {
+            Delegate delegate;
+            delegate.m_instance = nullptr;
+            delegate.m_function = [](void *, Args... args) -> R
+            {
+                return std::invoke(Function, std::forward<Args>(args)...);
+            };
+            return delegate;
+        }
+
+        template <auto Method, typename C>
+        static Delegate create(C *instance)
+        {
+            Delegate delegate;
+            delegate.m_instance = const_cast<void *>(static_cast<const void *>(instance));
+            delegate.m_function = [](void *instance, Args... args) -> R
+            {
+                return std::invoke(Method, static_cast<C *>(instance), std::forward<Args>(args)...);
+            };
+            return delegate;
+        }
+
+        R operator()(Args... args) const
+        {
+            return m_function(m_instance, std::forward<Args>(args)...);
+        }
+
+        explicit operator bool() const
+        {
+            return m_function != nullptr;
+        }
+
+        bool operator==(const Delegate &other) const = default;
+
+    private:
+        void *m_instance = nullptr;
+        R (*m_function)(void *, Args...) = nullptr;
+    };
+} // namespace hyper_engine
\ No newline at end of file
@@ -6,46 +6,125 @@
 
 #pragma once
 
-#include <functional>
-#include <unordered_map>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <vector>
 
+#include <hyper_core/assertion.hpp>
+#include <hyper_core/mpsc_queue.hpp>
 #include <hyper_core/own_ptr.hpp>
+#include <hyper_core/type_name.hpp>
 
+#include "hyper_event/delegate.hpp"
 #include "hyper_event/event_handler.hpp"
 #include "hyper_event/event_id_generator.hpp"
+#include "hyper_event/subscription_handle.hpp"
 
 namespace hyper_engine
 {
     class EventBus
     {
     public:
+        static constexpr uint32_t s_static_event_capacity = 32;
+
+    public:
+        EventBus()
+        {
+            m_handlers.resize(s_static_event_capacity);
+        }
+
+        ~EventBus()
+        {
+            while (PostedEvent *posted_event = m_posted_events.pop())
+            {
+                delete posted_event;
+            }
+        }
+
+        EventBus(const EventBus &) = delete;
+        EventBus &operator=(const EventBus &) = delete;
+
         template <typename T, typename... Args>
         void dispatch(Args &&...args)
         {
-            const size_t event_id = EventIdGenerator::type<T>();
-            if (!m_handlers.contains(event_id))
+            EventHandlerImpl<T> &event_handler = handler<T>();
+            event_handler.dispatch(T(std::forward<Args>(args)...));
+        }
+
+        // NOTE: Queued events are stored contiguously per event type, merged by their coalescing policy and delivered on the next flush
+        template <typename T, typename... Args>
+        void enqueue(Args &&...args)
+        {
+            EventHandlerImpl<T> &event_handler = handler<T>();
+            event_handler.enqueue(std::forward<Args>(args)...);
+        }
+
+        // NOTE: Safe to call from any thread, the events are queued once the main thread drains the posted events
+        template <typename T, typename... Args>
+        void post(Args &&...args)
+        {
+            // NOTE: The queue links the events through their embedded node, ownership is taken back when draining
+            m_posted_events.push(make_own<PostedEventImpl<T>>(std::forward<Args>(args)...).release());
+        }
+
+        void drain_posted_events()
+        {
+            while (PostedEvent *event = m_posted_events.pop())
             {
-                return;
+                const OwnPtr<PostedEvent> posted_event(event);
+                posted_event->enqueue(*this);
+            }
+        }
+
+        void flush()
+        {
+            // NOTE: Indexing, as handlers are allowed to create new event handlers while being flushed
+            for (size_t index = 0; index < m_handlers.size(); ++index)
+            {
+                if (m_handlers[index])
+                {
+                    m_handlers[index]->flush();
+                }
             }
+        }
 
-            const OwnPtr<EventHandler> &handler = m_handlers.at(event_id);
-            EventHandlerImpl<T> *event_handler = static_cast<EventHandlerImpl<T> *>(handler.get());
-            event_handler->dispatch(T(std::forward<Args>(args)...));
+        template <typename T, auto Method, typename C>
+        SubscriptionHandle subscribe(C *instance)
+        {
+            return subscribe<T>(Delegate<void(const T &)>::template create<Method>(instance));
+        }
+
+        template <typename T, auto Function>
+        SubscriptionHandle subscribe()
+        {
+            return subscribe<T>(Delegate<void(const T &)>::template create<Function>());
         }
 
-        // FIXME: To prevent functions being called which are no longer available, add an id system to unsubscribe event handlers
         template <typename T>
-        void subscribe(const std::function<void(const T &)> &callback)
+        SubscriptionHandle subscribe(const Delegate<void(const T &)> &delegate)
+        {
+            const uint32_t handler_index = EventBus::handler_index<T>();
+
+            EventHandlerImpl<T> &event_handler = handler<T>();
+            return {
+                .handler_index = handler_index,
+                .subscription_id = event_handler.subscribe(delegate),
+            };
+        }
+
+        void unsubscribe(SubscriptionHandle &handle)
         {
-            const size_t event_id = EventIdGenerator::type<T>();
-            if (!m_handlers.contains(event_id))
+            if (!handle.is_valid())
             {
-                m_handlers.insert({event_id, make_own<EventHandlerImpl<T>>()});
+                return;
             }
 
-            const OwnPtr<EventHandler> &handler = m_handlers.at(event_id);
-            EventHandlerImpl<T> *event_handler = static_cast<EventHandlerImpl<T> *>(handler.get());
-            event_handler->subscribe(callback);
+            HE_ASSERT(handle.handler_index < m_handlers.size());
+            m_handlers[handle.handler_index]->unsubscribe(handle.subscription_id);
+
+            handle = {};
         }
 
         static EventBus *&get()
@@ -55,6 +134,147 @@ namespace hyper_engine
         }
 
     private:
-        std::unordered_map<size_t, OwnPtr<EventHandler>> m_handlers;
+        class PostedEvent : public MpscNode
+        {
+        public:
+            virtual ~PostedEvent() = default;
+
+            virtual void enqueue(EventBus &event_bus) = 0;
+        };
+
+        template <typename T>
+        class PostedEventImpl final : public PostedEvent
+        {
+        public:
+            template <typename... Args>
+            explicit PostedEventImpl(Args &&...args)
+                : m_event(std::forward<Args>(args)...)
+            {
+            }
+
+            void enqueue(EventBus &event_bus) override
+            {
+                event_bus.enqueue<T>(std::move(m_event));
+            }
+
+        private:
+            T m_event;
+        };
+
+        // NOTE: The type name is compared as well, as two type names may hash to the same id
+        struct HandlerSlot
+        {
+            uint64_t event_id = 0;
+            std::string_view event_name;
+            uint32_t handler_index = s_invalid_index;
+        };
+
+    private:
+        static constexpr uint32_t s_invalid_index = std::numeric_limits<uint32_t>::max();
+
+    private:
+        template <typename T>
+        EventHandlerImpl<T> &handler()
+        {
+            const uint32_t handler_index = EventBus::handler_index<T>();
+
+            OwnPtr<EventHandler> &handler = m_handlers[handler_index];
+            if (!handler)
+            {
+                handler = make_own<EventHandlerImpl<T>>();
+            }
+
+            // NOTE: Catches two events sharing a static slot, colliding ids of dynamic events get separate slots
+            HE_ASSERT(handler->event_id() == EventIdGenerator::type<T>());
+
+            return static_cast<EventHandlerImpl<T> &>(*handler);
+        }
+
+        template <typename T>
+        uint32_t handler_index()
+        {
+            if constexpr (StaticEventSlot<T>::s_enabled)
+            {
+                static_assert(StaticEventSlot<T>::s_slot < s_static_event_capacity);
+                return StaticEventSlot<T>::s_slot;
+            }
+            else
+            {
+                return dynamic_handler_index(EventIdGenerator::type<T>(), type_name<T>());
+            }
+        }
+
+        // NOTE: Open addressing with linear probing, the table is kept at most half full
+        uint32_t dynamic_handler_index(const uint64_t event_id, const std::string_view event_name)
+        {
+            if (!m_handler_slots.empty())
+            {
+                const size_t mask = m_handler_slots.size() - 1;
+                for (size_t index = event_id & mask;; index = (index + 1) & mask)
+                {
+                    const HandlerSlot &slot = m_handler_slots[index];
+                    if (slot.handler_index == s_invalid_index)
+                    {
+                        break;
+                    }
+
+                    if (slot.event_id == event_id && slot.event_name == event_name)
+                    {
+                        return slot.handler_index;
+                    }
+                }
+            }
+
+            const uint32_t handler_index = static_cast<uint32_t>(m_handlers.size());
+            m_handlers.emplace_back();
+
+            const size_t dynamic_handler_count = m_handlers.size() - s_static_event_capacity;
+            if (dynamic_handler_count * 2 > m_handler_slots.size())
+            {
+                rehash_handler_slots(std::bit_ceil(dynamic_handler_count * 4));
+            }
+
+            insert_handler_slot({
+                .event_id = event_id,
+                .event_name = event_name,
+                .handler_index = handler_index,
+            });
+
+            return handler_index;
+        }
+
+        void rehash_handler_slots(const size_t capacity)
+        {
+            std::vector<HandlerSlot> handler_slots(capacity);
+            std::swap(m_handler_slots, handler_slots);
+
+            for (const HandlerSlot &slot : handler_slots)
+            {
+                if (slot.handler_index != s_invalid_index)
+                {
+                    insert_handler_slot(slot);
+                }
+            }
+        }
+
+        void insert_handler_slot(const HandlerSlot &handler_slot)
+        {
+            const size_t mask = m_handler_slots.size() - 1;
+
+            size_t index = handler_slot.event_id & mask;
+            while (m_handler_slots[index].handler_index != s_invalid_index)
+            {
+                index = (index + 1) & mask;
+            }
+
+            m_handler_slots[index] = handler_slot;
+        }
+
+    private:
+        // NOTE: The first slots are reserved for the static events, every other event type is appended on first use
+        std::vector<OwnPtr<EventHandler>> m_handlers;
+        std::vector<HandlerSlot> m_handler_slots;
+
+        MpscQueue<PostedEvent> m_posted_events;
     };
-} // namespace hyper_engine
+} // namespace hyper_engine
\ No newline at end of file
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+
+// NOTE: Declares how queued events of the type are merged until the next flush
+#define HE_COALESCE_EVENT(type, policy)                            \
+    template <>                                                    \
+    struct EventCoalescingPolicy<type>                             \
+    {                                                              \
+        static constexpr EventCoalescing s_policy = (policy);      \
+    }
+
+namespace hyper_engine
+{
+    enum class EventCoalescing : uint8_t
+    {
+        // NOTE: Every queued event is delivered
+        KeepAll,
+        // NOTE: Only the latest queued event is delivered
+        LastValue,
+        // NOTE: The queued events are merged into one event through `void accumulate(const T &event)`
+        Accumulate,
+    };
+
+    template <typename T>
+    struct EventCoalescingPolicy
+    {
+        static constexpr EventCoalescing s_policy = EventCoalescing::KeepAll;
+    };
+} // namespace hyper_engine
\ No newline at end of file
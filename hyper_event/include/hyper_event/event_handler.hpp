@@ -6,35 +6,231 @@
 
 #pragma once
 
-#include <functional>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
 #include <vector>
 
+#include <fmt/format.h>
+
+#include <hyper_core/metrics.hpp>
+#include <hyper_core/type_name.hpp>
+
+#include "hyper_event/delegate.hpp"
+#include "hyper_event/event_coalescing.hpp"
+#include "hyper_event/event_id_generator.hpp"
+
 namespace hyper_engine
 {
     class EventHandler
     {
     public:
+        explicit EventHandler(const uint64_t event_id)
+            : m_event_id(event_id)
+        {
+        }
+
         virtual ~EventHandler() = default;
+
+        virtual void unsubscribe(uint32_t subscription_id) = 0;
+        virtual void flush() = 0;
+
+        uint64_t event_id() const
+        {
+            return m_event_id;
+        }
+
+    private:
+        uint64_t m_event_id = 0;
     };
 
     template <typename T>
     class EventHandlerImpl final : public EventHandler
     {
     public:
-        void subscribe(const std::function<void(const T &)> &callback)
+        EventHandlerImpl()
+            : EventHandler(EventIdGenerator::type<T>())
+            , m_dispatched_counter(MetricsRegistry::get()->counter(fmt::format("event.dispatched.{}", type_name<T>())))
+            , m_dropped_counter(MetricsRegistry::get()->counter(fmt::format("event.dropped.{}", type_name<T>())))
+        {
+        }
+
+        uint32_t subscribe(const Delegate<void(const T &)> &delegate)
         {
-            m_callbacks.push_back(callback);
+            m_next_subscription_id += 1;
+            m_subscriptions.push_back({
+                .id = m_next_subscription_id,
+                .delegate = delegate,
+            });
+
+            return m_next_subscription_id;
+        }
+
+        void unsubscribe(const uint32_t subscription_id) override
+        {
+            const auto iterator = std::ranges::find(m_subscriptions, subscription_id, &Subscription::id);
+            if (iterator == m_subscriptions.end())
+            {
+                return;
+            }
+
+            // NOTE: Removing while dispatching would invalidate the running loop, so the subscription is only cleared here
+            iterator->delegate = {};
+            m_dirty = true;
+
+            if (m_dispatch_depth == 0)
+            {
+                remove_unsubscribed();
+            }
         }
 
         void dispatch(const T &event)
         {
-            for (const std::function<void(const T &)> &callback : m_callbacks)
+            m_dispatch_depth += 1;
+
+            // NOTE: Indexing, as handlers are allowed to subscribe while being dispatched
+            uint64_t delivered_count = 0;
+            const size_t subscription_count = m_subscriptions.size();
+            for (size_t index = 0; index < subscription_count; ++index)
             {
-                callback(event);
+                const Delegate<void(const T &)> delegate = m_subscriptions[index].delegate;
+                if (delegate)
+                {
+                    delegate(event);
+                    delivered_count += 1;
+                }
+            }
+
+            m_dispatch_depth -= 1;
+
+            add_delivered(delivered_count);
+
+            if (m_dispatch_depth == 0)
+            {
+                remove_unsubscribed();
             }
         }
 
+        // NOTE: Events are queued even without subscribers, so subscribers added before the next flush still receive them
+        template <typename... Args>
+        void enqueue(Args &&...args)
+        {
+            constexpr EventCoalescing coalescing = EventCoalescingPolicy<T>::s_policy;
+            if constexpr (coalescing == EventCoalescing::LastValue)
+            {
+                if (!m_queued_events.empty())
+                {
+                    m_queued_events.back() = T(std::forward<Args>(args)...);
+                    return;
+                }
+            }
+            else if constexpr (coalescing == EventCoalescing::Accumulate)
+            {
+                static_assert(requires(T &event) { event.accumulate(event); }, "Accumulated events need an accumulate function");
+
+                if (!m_queued_events.empty())
+                {
+                    m_queued_events.back().accumulate(T(std::forward<Args>(args)...));
+                    return;
+                }
+            }
+
+            m_queued_events.emplace_back(std::forward<Args>(args)...);
+        }
+
+        void flush() override
+        {
+            if (m_queued_events.empty())
+            {
+                return;
+            }
+
+            // NOTE: Events nobody subscribed to until the flush are dropped, the counter reveals subscribers that were added too late
+            if (m_subscriptions.empty())
+            {
+                m_dropped_counter.add(m_queued_events.size());
+                m_queued_events.clear();
+                return;
+            }
+
+            // NOTE: Swapping the buffers, so handlers can enqueue new events for the next flush
+            std::swap(m_queued_events, m_flushed_events);
+
+            m_dispatch_depth += 1;
+
+            uint64_t delivered_count = 0;
+            const size_t subscription_count = m_subscriptions.size();
+            for (size_t index = 0; index < subscription_count; ++index)
+            {
+                for (const T &event : m_flushed_events)
+                {
+                    // NOTE: Reloading the delegate, as the handler may unsubscribe itself in between
+                    const Delegate<void(const T &)> delegate = m_subscriptions[index].delegate;
+                    if (!delegate)
+                    {
+                        break;
+                    }
+
+                    delegate(event);
+                    delivered_count += 1;
+                }
+            }
+
+            m_dispatch_depth -= 1;
+
+            add_delivered(delivered_count);
+
+            if (m_dispatch_depth == 0)
+            {
+                remove_unsubscribed();
+            }
+
+            m_flushed_events.clear();
+        }
+
+    private:
+        struct Subscription
+        {
+            uint32_t id = 0;
+            Delegate<void(const T &)> delegate;
+        };
+
     private:
-        std::vector<std::function<void(const T &)>> m_callbacks;
+        // NOTE: Counts deliveries to handlers, so posts without subscribers and coalesced events aren't included
+        void add_delivered(const uint64_t delivered_count)
+        {
+            if (delivered_count != 0)
+            {
+                m_dispatched_counter.add(delivered_count);
+            }
+        }
+
+        void remove_unsubscribed()
+        {
+            if (!m_dirty)
+            {
+                return;
+            }
+
+            std::erase_if(
+                m_subscriptions,
+                [](const Subscription &subscription)
+                {
+                    return !subscription.delegate;
+                });
+            m_dirty = false;
+        }
+
+    private:
+        Counter &m_dispatched_counter;
+        Counter &m_dropped_counter;
+
+        std::vector<Subscription> m_subscriptions;
+        uint32_t m_next_subscription_id = 0;
+        uint32_t m_dispatch_depth = 0;
+        bool m_dirty = false;
+
+        std::vector<T> m_queued_events;
+        std::vector<T> m_flushed_events;
     };
-} // namespace hyper_engine
+} // namespace hyper_engine
\ No newline at end of file
@@ -6,25 +6,54 @@
 
 #pragma once
 
-#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <hyper_core/type_name.hpp>
+
+// NOTE: Reserves a fixed handler slot for the event, so the event bus can dispatch it without any lookup
+#define HE_STATIC_EVENT(type, slot)                       \
+    template <>                                           \
+    struct StaticEventSlot<type>                          \
+    {                                                     \
+        static constexpr bool s_enabled = true;           \
+        static constexpr uint32_t s_slot = (slot);        \
+    }
 
 namespace hyper_engine
 {
+    template <typename T>
+    struct StaticEventSlot
+    {
+        static constexpr bool s_enabled = false;
+        static constexpr uint32_t s_slot = 0;
+    };
+
+    // NOTE: The ids are hashed from the type names, so they are equal across shared libraries and builds and can be serialized
     class EventIdGenerator
     {
     public:
-        template <typename>
-        static size_t type()
+        template <typename T>
+        static constexpr uint64_t type()
         {
-            static const size_t value = EventIdGenerator::identifier();
+            constexpr uint64_t value = EventIdGenerator::hash(type_name<T>());
             return value;
         }
 
-    private:
-        static size_t identifier()
+        static constexpr uint64_t hash(const std::string_view name)
         {
-            static size_t value = 0;
-            return value++;
+            uint64_t value = s_fnv_offset_basis;
+            for (const char character : name)
+            {
+                value ^= static_cast<uint8_t>(character);
+                value *= s_fnv_prime;
+            }
+
+            return value;
         }
+
+    private:
+        static constexpr uint64_t s_fnv_offset_basis = 0xcbf29ce484222325;
+        static constexpr uint64_t s_fnv_prime = 0x00000100000001b3;
     };
-} // namespace hyper_engine
+} // namespace hyper_engine
\ No newline at end of file
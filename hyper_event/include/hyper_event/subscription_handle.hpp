@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace hyper_engine
+{
+    struct SubscriptionHandle
+    {
+        uint32_t handler_index = 0;
+        uint32_t subscription_id = 0;
+
+        bool is_valid() const
+        {
+            return subscription_id != 0;
+        }
+    };
+} // namespace hyper_engine
\ No newline at end of file
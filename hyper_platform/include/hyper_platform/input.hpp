@@ -7,8 +7,10 @@
 #pragma once
 
 #include <unordered_map>
+#include <vector>
 
 #include <hyper_core/math.hpp>
+#include <hyper_event/subscription_handle.hpp>
 
 #include "hyper_platform/forward.hpp"
 #include "hyper_platform/key_codes.hpp"
@@ -21,8 +23,7 @@ namespace hyper_engine
     public:
         Input();
 
-        // FIXME: Add unsubscription event handlers
-        ~Input() = default;
+        ~Input();
 
         bool is_key_pressed(KeyCode key_code) const;
         bool is_mouse_button_pressed(MouseCode mouse_code) const;
@@ -42,5 +43,7 @@ namespace hyper_engine
         std::unordered_map<KeyCode, bool> m_keys;
         std::unordered_map<MouseCode, bool> m_mouse_buttons;
         glm::vec2 m_mouse_position = {0.0, 0.0};
+
+        std::vector<SubscriptionHandle> m_subscriptions;
     };
 } // namespace hyper_engine
\ No newline at end of file
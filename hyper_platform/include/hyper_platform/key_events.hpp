@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <hyper_event/event_coalescing.hpp>
+#include <hyper_event/event_id_generator.hpp>
+
 #include "hyper_platform/key_codes.hpp"
 
 namespace hyper_engine
@@ -31,4 +34,10 @@ namespace hyper_engine
     private:
         KeyCode m_key_code = KeyCode::Unknown;
     };
+
+    HE_STATIC_EVENT(KeyPressEvent, 3);
+    HE_STATIC_EVENT(KeyReleaseEvent, 4);
+
+    HE_COALESCE_EVENT(KeyPressEvent, EventCoalescing::KeepAll);
+    HE_COALESCE_EVENT(KeyReleaseEvent, EventCoalescing::KeepAll);
 } // namespace hyper_engine
@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <hyper_event/event_coalescing.hpp>
+#include <hyper_event/event_id_generator.hpp>
+
 #include "hyper_platform/mouse_codes.hpp"
 
 namespace hyper_engine
@@ -36,14 +39,20 @@ namespace hyper_engine
     class MouseMoveEvent
     {
     public:
-        MouseMoveEvent(float x, float y);
+        MouseMoveEvent(float x, float y, float delta_x, float delta_y);
+
+        void accumulate(const MouseMoveEvent &event);
 
         float x() const;
         float y() const;
+        float delta_x() const;
+        float delta_y() const;
 
     private:
         float m_x = 0.0;
         float m_y = 0.0;
+        float m_delta_x = 0.0;
+        float m_delta_y = 0.0;
     };
 
     // FIXME: Change individual deltas to vector
@@ -52,6 +61,8 @@ namespace hyper_engine
     public:
         MouseScrollEvent(float delta_x, float delta_y);
 
+        void accumulate(const MouseScrollEvent &event);
+
         float delta_x() const;
         float delta_y() const;
 
@@ -59,4 +70,12 @@ namespace hyper_engine
         float m_delta_x = 0.0;
         float m_delta_y = 0.0;
     };
+
+    HE_STATIC_EVENT(MouseButtonPressEvent, 5);
+    HE_STATIC_EVENT(MouseButtonReleaseEvent, 6);
+    HE_STATIC_EVENT(MouseMoveEvent, 7);
+    HE_STATIC_EVENT(MouseScrollEvent, 8);
+
+    HE_COALESCE_EVENT(MouseMoveEvent, EventCoalescing::Accumulate);
+    HE_COALESCE_EVENT(MouseScrollEvent, EventCoalescing::Accumulate);
 } // namespace hyper_engine
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <hyper_event/event_id_generator.hpp>
+
 union SDL_Event;
 
 namespace hyper_engine
@@ -20,4 +22,6 @@ namespace hyper_engine
     private:
         const SDL_Event *m_event;
     };
+
+    HE_STATIC_EVENT(SdlEvent, 9);
 } // namespace hyper_engine
\ No newline at end of file
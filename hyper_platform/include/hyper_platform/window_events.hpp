@@ -8,6 +8,9 @@
 
 #include <cstdint>
 
+#include <hyper_event/event_coalescing.hpp>
+#include <hyper_event/event_id_generator.hpp>
+
 namespace hyper_engine
 {
     class WindowCloseEvent
@@ -43,4 +46,11 @@ namespace hyper_engine
         uint32_t m_width = 0;
         uint32_t m_height = 0;
     };
+
+    HE_STATIC_EVENT(WindowCloseEvent, 0);
+    HE_STATIC_EVENT(WindowMoveEvent, 1);
+    HE_STATIC_EVENT(WindowResizeEvent, 2);
+
+    HE_COALESCE_EVENT(WindowMoveEvent, EventCoalescing::LastValue);
+    HE_COALESCE_EVENT(WindowResizeEvent, EventCoalescing::LastValue);
 } // namespace hyper_engine
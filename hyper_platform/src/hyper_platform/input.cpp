@@ -16,11 +16,19 @@ namespace hyper_engine
 {
     Input::Input()
     {
-        EventBus::get()->subscribe<MouseMoveEvent>(HE_BIND_FUNCTION(Input::on_mouse_move));
-        EventBus::get()->subscribe<MouseButtonPressEvent>(HE_BIND_FUNCTION(Input::on_mouse_button_press));
-        EventBus::get()->subscribe<MouseButtonReleaseEvent>(HE_BIND_FUNCTION(Input::on_mouse_button_release));
-        EventBus::get()->subscribe<KeyPressEvent>(HE_BIND_FUNCTION(Input::on_key_press));
-        EventBus::get()->subscribe<KeyReleaseEvent>(HE_BIND_FUNCTION(Input::on_key_release));
+        m_subscriptions.push_back(EventBus::get()->subscribe<MouseMoveEvent, &Input::on_mouse_move>(this));
+        m_subscriptions.push_back(EventBus::get()->subscribe<MouseButtonPressEvent, &Input::on_mouse_button_press>(this));
+        m_subscriptions.push_back(EventBus::get()->subscribe<MouseButtonReleaseEvent, &Input::on_mouse_button_release>(this));
+        m_subscriptions.push_back(EventBus::get()->subscribe<KeyPressEvent, &Input::on_key_press>(this));
+        m_subscriptions.push_back(EventBus::get()->subscribe<KeyReleaseEvent, &Input::on_key_release>(this));
+    }
+
+    Input::~Input()
+    {
+        for (SubscriptionHandle &subscription : m_subscriptions)
+        {
+            EventBus::get()->unsubscribe(subscription);
+        }
     }
 
     bool Input::is_key_pressed(const KeyCode key_code) const
@@ -8,10 +8,20 @@
 
 namespace hyper_engine
 {
-    MouseMoveEvent::MouseMoveEvent(const float x, const float y)
+    MouseMoveEvent::MouseMoveEvent(const float x, const float y, const float delta_x, const float delta_y)
         : m_x(x)
         , m_y(y)
+        , m_delta_x(delta_x)
+        , m_delta_y(delta_y)
+    {
+    }
+
+    void MouseMoveEvent::accumulate(const MouseMoveEvent &event)
     {
+        m_x = event.m_x;
+        m_y = event.m_y;
+        m_delta_x += event.m_delta_x;
+        m_delta_y += event.m_delta_y;
     }
 
     float MouseMoveEvent::x() const
@@ -24,6 +34,16 @@ namespace hyper_engine
         return m_y;
     }
 
+    float MouseMoveEvent::delta_x() const
+    {
+        return m_delta_x;
+    }
+
+    float MouseMoveEvent::delta_y() const
+    {
+        return m_delta_y;
+    }
+
     MouseButtonPressEvent::MouseButtonPressEvent(const MouseCode mouse_code)
         : m_mouse_code(mouse_code)
     {
@@ -50,6 +70,12 @@ namespace hyper_engine
     {
     }
 
+    void MouseScrollEvent::accumulate(const MouseScrollEvent &event)
+    {
+        m_delta_x += event.m_delta_x;
+        m_delta_y += event.m_delta_y;
+    }
+
     float MouseScrollEvent::delta_x() const
     {
         return m_delta_x;
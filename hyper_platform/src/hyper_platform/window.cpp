@@ -45,19 +45,21 @@ namespace hyper_engine
         SDL_Event event;
         while (SDL_PollEvent(&event))
         {
+            // NOTE: The SDL event only lives until the next poll, so it can't be queued. Press and release events are dispatched
+            //       directly as well, as the queues of different event types are not flushed in submission order
             EventBus::get()->dispatch<SdlEvent>(&event);
 
             switch (event.type)
             {
                 // NOTE: Window Events
             case SDL_EVENT_QUIT:
-                EventBus::get()->dispatch<WindowCloseEvent>();
+                EventBus::get()->enqueue<WindowCloseEvent>();
                 break;
             case SDL_EVENT_WINDOW_MOVED:
-                EventBus::get()->dispatch<WindowMoveEvent>(event.window.data1, event.window.data2);
+                EventBus::get()->enqueue<WindowMoveEvent>(event.window.data1, event.window.data2);
                 break;
             case SDL_EVENT_WINDOW_RESIZED:
-                EventBus::get()->dispatch<WindowResizeEvent>(event.window.data1, event.window.data2);
+                EventBus::get()->enqueue<WindowResizeEvent>(event.window.data1, event.window.data2);
                 break;
                 // NOTE: Key Events
             case SDL_EVENT_KEY_DOWN:
@@ -68,7 +70,7 @@ namespace hyper_engine
                 break;
                 // NOTE: Mouse Events
             case SDL_EVENT_MOUSE_MOTION:
-                EventBus::get()->dispatch<MouseMoveEvent>(event.motion.x, event.motion.y);
+                EventBus::get()->enqueue<MouseMoveEvent>(event.motion.x, event.motion.y, event.motion.xrel, event.motion.yrel);
                 break;
             case SDL_EVENT_MOUSE_BUTTON_DOWN:
                 EventBus::get()->dispatch<MouseButtonPressEvent>(static_cast<MouseCode>(event.button.button));
@@ -77,7 +79,7 @@ namespace hyper_engine
                 EventBus::get()->dispatch<MouseButtonReleaseEvent>(static_cast<MouseCode>(event.button.button));
                 break;
             case SDL_EVENT_MOUSE_WHEEL:
-                EventBus::get()->dispatch<MouseScrollEvent>(event.wheel.x, event.wheel.y);
+                EventBus::get()->enqueue<MouseScrollEvent>(event.wheel.x, event.wheel.y);
                 break;
             default:
                 break;
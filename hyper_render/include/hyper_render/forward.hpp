@@ -8,6 +8,7 @@
 
 namespace hyper_engine
 {
+    class GeometryArena;
     struct GltfMaterial;
     class Mesh;
 
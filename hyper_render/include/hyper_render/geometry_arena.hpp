@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <hyper_core/math.hpp>
+#include <hyper_core/offset_allocator.hpp>
+#include <hyper_core/ref_ptr.hpp>
+#include <hyper_rhi/forward.hpp>
+#include <hyper_rhi/graphics_device.hpp>
+#include <hyper_rhi/render_pass.hpp>
+
+struct ShaderMesh;
+
+namespace hyper_engine
+{
+    // NOTE: Range of elements in one page of the arena, vertices for vertex pages and indices for index pages
+    struct GeometryRange
+    {
+        uint32_t page = 0;
+        uint32_t offset = 0;
+        uint32_t count = 0;
+    };
+
+    // NOTE: Shared storage for the geometry of every mesh. The vertex streams and the index buffers are split into a few large pages,
+    //       which the meshes sub-allocate their ranges from, and the mesh descriptors live in one array indexed by the mesh id.
+    class GeometryArena
+    {
+    public:
+        static constexpr uint32_t s_vertex_page_capacity = 1 << 20;
+        static constexpr uint32_t s_index_page_capacity = 1 << 22;
+        static constexpr uint32_t s_mesh_capacity = 1 << 14;
+
+        struct VertexPage
+        {
+            RefPtr<Buffer> positions_buffer;
+            RefPtr<Buffer> normals_buffer;
+            RefPtr<Buffer> colors_buffer;
+            RefPtr<Buffer> tex_coords_buffer;
+            OffsetAllocator allocator;
+        };
+
+        struct IndexPage
+        {
+            IndexFormat format = IndexFormat::Uint32;
+            RefPtr<Buffer> buffer;
+            OffsetAllocator allocator;
+        };
+
+        struct PendingFrees
+        {
+            std::vector<GeometryRange> vertex_ranges;
+            std::vector<GeometryRange> index_ranges;
+            std::vector<uint32_t> mesh_ids;
+        };
+
+    public:
+        GeometryArena();
+
+        GeometryRange allocate_vertices(uint32_t count);
+        GeometryRange allocate_indices(IndexFormat format, uint32_t count);
+        uint32_t allocate_mesh();
+
+        // NOTE: Has to be called after the device waited for the fence of the frame, releases the ranges freed in the same slot before
+        void begin_frame(uint32_t frame_index);
+
+        // NOTE: The ranges may still be read by frames in flight, so they are only released once their slot comes around again
+        void free_vertices(const GeometryRange &range);
+        void free_indices(const GeometryRange &range);
+        void free_mesh(uint32_t mesh_id);
+
+        void write_vertices(
+            const RefPtr<CommandList> &command_list,
+            const GeometryRange &range,
+            std::span<const glm::uvec2> positions,
+            std::span<const uint32_t> normals,
+            std::span<const uint32_t> colors,
+            std::span<const uint32_t> tex_coords) const;
+        // NOTE: The indices are narrowed to the format of the page, which has to be large enough for every one of them
+        void write_indices(const RefPtr<CommandList> &command_list, const GeometryRange &range, std::span<const uint32_t> indices) const;
+        void write_mesh(const RefPtr<CommandList> &command_list, uint32_t mesh_id, const ShaderMesh &mesh) const;
+
+        const VertexPage &vertex_page(uint32_t page) const;
+        const IndexPage &index_page(uint32_t page) const;
+        RefPtr<Buffer> mesh_buffer() const;
+
+    private:
+        void update_metrics() const;
+
+    private:
+        std::vector<VertexPage> m_vertex_pages;
+        std::vector<IndexPage> m_index_pages;
+
+        RefPtr<Buffer> m_mesh_buffer;
+        OffsetAllocator m_mesh_allocator;
+
+        uint32_t m_frame_index = 0;
+        std::array<PendingFrees, GraphicsDevice::s_frame_count> m_pending_frees;
+    };
+} // namespace hyper_engine
\ No newline at end of file
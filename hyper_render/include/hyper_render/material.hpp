@@ -8,6 +8,7 @@
 
 #include <hyper_core/math.hpp>
 #include <hyper_core/ref_ptr.hpp>
+#include <hyper_rhi/format.hpp>
 #include <hyper_rhi/forward.hpp>
 #include <hyper_rhi/render_pipeline.hpp>
 
@@ -22,6 +23,8 @@ namespace hyper_engine
     struct MaterialInstance
     {
         RefPtr<RenderPipeline> pipeline;
+        // NOTE: Variant of the pipeline reading its objects from the persistent scene buffer, only set for opaque materials
+        RefPtr<RenderPipeline> indirect_pipeline;
         MaterialPassType pass_type = MaterialPassType::MainColor;
 
         RefPtr<Buffer> buffer;
@@ -42,10 +45,7 @@ namespace hyper_engine
         };
 
     public:
-        GltfMetallicRoughness(
-            const ShaderCompiler &shader_compiler,
-            const RefPtr<Texture> &render_texture,
-            const RefPtr<Texture> &depth_texture);
+        GltfMetallicRoughness(const ShaderCompiler &shader_compiler, Format render_format, Format depth_format);
 
         MaterialInstance
             write_material(const RefPtr<CommandList> &command_list, MaterialPassType pass_type, const MaterialResources &resources) const;
@@ -53,6 +53,7 @@ namespace hyper_engine
     private:
         // FIXME: Make this RefPtr by using a factory function
         RefPtr<RenderPipeline> m_opaque_pipeline;
+        RefPtr<RenderPipeline> m_indirect_opaque_pipeline;
         RefPtr<RenderPipeline> m_transparent_pipeline;
     };
 } // namespace hyper_engine
\ No newline at end of file
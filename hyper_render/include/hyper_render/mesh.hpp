@@ -9,9 +9,13 @@
 #include <string>
 #include <vector>
 
+#include <hyper_core/bounds.hpp>
+#include <hyper_core/math.hpp>
 #include <hyper_core/ref_ptr.hpp>
 #include <hyper_rhi/forward.hpp>
+#include <hyper_rhi/render_pass.hpp>
 
+#include "hyper_render/geometry_arena.hpp"
 #include "hyper_render/material.hpp"
 
 namespace hyper_engine
@@ -21,11 +25,32 @@ namespace hyper_engine
         MaterialInstance data;
     };
 
+    // NOTE: Cluster of a surface, its triangles are a contiguous range of the index buffer. The bounds and the normal cone are in
+    //       mesh space, a cutoff of one means the cone is too wide to ever be backfacing.
+    struct GltfMeshlet
+    {
+        uint32_t first_index = 0;
+        uint32_t index_count = 0;
+
+        BoundingSphere bounding_sphere;
+        glm::vec3 cone_apex = {0.0f, 0.0f, 0.0f};
+        glm::vec3 cone_axis = {0.0f, 0.0f, 1.0f};
+        float cone_cutoff = 1.0f;
+    };
+
     struct GltfSurface
     {
+        // NOTE: Offset into the index page of the mesh, the meshlet ranges are as well
         uint32_t start_index = 0;
         uint32_t count = 0;
         RefPtr<GltfMaterial> material;
+
+        // NOTE: Bounds in mesh space, computed from the vertices of the surface at load time
+        BoundingBox bounds;
+        BoundingSphere bounding_sphere;
+
+        // NOTE: Covers exactly the index range of the surface, the indices are reordered meshlet by meshlet
+        std::vector<GltfMeshlet> meshlets;
     };
 
     class Mesh
@@ -34,33 +59,37 @@ namespace hyper_engine
         Mesh(
             std::string name,
             std::vector<GltfSurface> surfaces,
-            RefPtr<Buffer> positions_buffer,
-            RefPtr<Buffer> normals_buffer,
-            RefPtr<Buffer> colors_buffer,
-            RefPtr<Buffer> tex_coords_buffer,
-            RefPtr<Buffer> mesh_buffer,
-            RefPtr<Buffer> indices_buffer);
+            RefPtr<GeometryArena> geometry_arena,
+            const GeometryRange &vertex_range,
+            const GeometryRange &index_range,
+            uint32_t mesh_id);
+        ~Mesh();
+
+        Mesh(const Mesh &) = delete;
+        Mesh &operator=(const Mesh &) = delete;
 
         std::string_view name() const;
 
         const std::vector<GltfSurface> &surfaces() const;
-        RefPtr<Buffer> positions_buffer() const;
-        RefPtr<Buffer> normals_buffer() const;
-        RefPtr<Buffer> colors_buffer() const;
-        RefPtr<Buffer> tex_coords_buffer() const;
-        RefPtr<Buffer> mesh_buffer() const;
-        RefPtr<Buffer> indices_buffer() const;
+        const BoundingBox &bounds() const;
+        const BoundingSphere &bounding_sphere() const;
+
+        const GeometryRange &vertex_range() const;
+        const GeometryRange &index_range() const;
+        uint32_t mesh_id() const;
+
+        RefPtr<Buffer> index_buffer() const;
+        IndexFormat index_format() const;
 
     private:
         std::string m_name;
         std::vector<GltfSurface> m_surfaces;
+        BoundingBox m_bounds;
+        BoundingSphere m_bounding_sphere;
 
-        RefPtr<Buffer> m_positions_buffer;
-        RefPtr<Buffer> m_normals_buffer;
-        RefPtr<Buffer> m_colors_buffer;
-        RefPtr<Buffer> m_tex_coords_buffer;
-
-        RefPtr<Buffer> m_mesh_buffer;
-        RefPtr<Buffer> m_indices_buffer;
+        RefPtr<GeometryArena> m_geometry_arena;
+        GeometryRange m_vertex_range;
+        GeometryRange m_index_range;
+        uint32_t m_mesh_id = 0;
     };
 } // namespace hyper_engine
\ No newline at end of file
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <hyper_core/bit_flags.hpp>
+#include <hyper_core/ref_ptr.hpp>
+#include <hyper_rhi/command_list.hpp>
+#include <hyper_rhi/forward.hpp>
+#include <hyper_rhi/texture.hpp>
+
+#include "hyper_render/transient_resource_allocator.hpp"
+
+namespace hyper_engine
+{
+    enum class ResourceUsage : uint8_t
+    {
+        None,
+        ColorAttachment,
+        DepthStencilAttachment,
+        ShaderRead,
+        ShaderWrite,
+        IndirectRead,
+        TransferRead,
+        TransferWrite,
+        Present,
+    };
+
+    struct RenderGraphResource
+    {
+        uint32_t index = std::numeric_limits<uint32_t>::max();
+    };
+
+    struct RenderGraphAccess
+    {
+        RenderGraphResource resource;
+        ResourceUsage usage = ResourceUsage::None;
+    };
+
+    struct RenderGraphPassDescriptor
+    {
+        std::string label;
+        std::vector<RenderGraphAccess> accesses;
+        // NOTE: Passes with side effects are never culled, even if nothing reads their outputs
+        bool side_effects = false;
+        std::function<void(const RefPtr<CommandList> &)> execute;
+    };
+
+    // NOTE: Rebuilt every frame. Passes declare how they access the resources, the graph culls passes whose outputs are never used,
+    //       groups independent passes into levels and records one batch of barriers per level with the exact stages of both sides.
+    class RenderGraph
+    {
+    public:
+        // NOTE: Resources with a final usage are transitioned into it at the end of the graph, which also keeps their writers alive
+        RenderGraphResource import_texture(const RefPtr<Texture> &texture, ResourceUsage final_usage = ResourceUsage::None);
+        RenderGraphResource import_buffer(const RefPtr<Buffer> &buffer, ResourceUsage final_usage = ResourceUsage::None);
+
+        // NOTE: Transient textures only live within the frame and share their memory with transient textures of disjoint lifetimes.
+        //       Textures only used as attachments of a single pass are lazily allocated, that pass shouldn't store them.
+        RenderGraphResource create_texture(const TextureDescriptor &descriptor);
+
+        void add_pass(RenderGraphPassDescriptor descriptor);
+
+        // NOTE: Culls and schedules the passes and allocates the transient textures, which can be queried afterwards
+        void compile();
+        // NOTE: Records every pass that survived culling and resets the graph for the next frame
+        void execute(const RefPtr<CommandList> &command_list);
+
+        const RefPtr<Texture> &texture(RenderGraphResource resource) const;
+        const RefPtr<TextureView> &texture_view(RenderGraphResource resource) const;
+
+    private:
+        struct UsageInfo
+        {
+            BitFlags<BarrierPipelineStage> stages = BarrierPipelineStage::None;
+            BitFlags<BarrierAccess> access = BarrierAccess::None;
+            BarrierTextureLayout layout = BarrierTextureLayout::Undefined;
+            bool write = false;
+        };
+
+        struct ResourceState
+        {
+            BarrierTextureLayout layout = BarrierTextureLayout::Undefined;
+            BitFlags<BarrierPipelineStage> write_stages = BarrierPipelineStage::None;
+            BitFlags<BarrierAccess> write_access = BarrierAccess::None;
+            BitFlags<BarrierPipelineStage> read_stages = BarrierPipelineStage::None;
+            BitFlags<BarrierPipelineStage> visible_stages = BarrierPipelineStage::None;
+            BitFlags<BarrierAccess> visible_access = BarrierAccess::None;
+        };
+
+        struct Resource
+        {
+            RefPtr<Texture> texture;
+            RefPtr<TextureView> texture_view;
+            RefPtr<Buffer> buffer;
+            ResourceUsage final_usage = ResourceUsage::None;
+            ResourceState state;
+            uint32_t transient_index = std::numeric_limits<uint32_t>::max();
+            std::vector<uint32_t> aliased_resources;
+
+            // NOTE: Transient textures are only created when compiling the graph
+            bool is_texture() const
+            {
+                return texture != nullptr || transient_index != std::numeric_limits<uint32_t>::max();
+            }
+        };
+
+        struct Pass
+        {
+            RenderGraphPassDescriptor descriptor;
+            uint32_t level = 0;
+            bool culled = false;
+        };
+
+    private:
+        static UsageInfo usage_info(ResourceUsage usage);
+
+        void cull_passes();
+        void schedule_passes();
+        void allocate_transient_textures();
+
+        void transition(Resource &resource, const UsageInfo &usage, Barriers &barriers) const;
+
+    private:
+        std::vector<Resource> m_resources;
+        std::vector<Pass> m_passes;
+        std::vector<uint32_t> m_schedule;
+        bool m_compiled = false;
+
+        std::vector<TransientTextureRequest> m_transient_requests;
+        std::vector<uint32_t> m_transient_resources;
+        TransientResourceAllocator m_transient_allocator;
+    };
+} // namespace hyper_engine
\ No newline at end of file
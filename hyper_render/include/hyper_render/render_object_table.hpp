@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include <entt/entt.hpp>
+
+#include "hyper_render/renderable.hpp"
+
+namespace hyper_engine
+{
+    class TransformHierarchy;
+
+    // NOTE: Persistent list of render objects for every entity with a model. Added, changed and removed models are tracked through
+    //       the registry signals and moved entities through the transform hierarchy, so static scenes don't touch the draw context.
+    class RenderObjectTable
+    {
+    public:
+        struct SurfaceRange
+        {
+            uint32_t offset = 0;
+            uint32_t count = 0;
+        };
+
+    public:
+        RenderObjectTable(entt::registry &registry, const TransformHierarchy &transform_hierarchy);
+        ~RenderObjectTable();
+
+        RenderObjectTable(const RenderObjectTable &) = delete;
+        RenderObjectTable &operator=(const RenderObjectTable &) = delete;
+
+        void update();
+        // NOTE: The model and material indices of the components wrap around the given models and material variants
+        void sync(std::span<const RefPtr<LoadedGltf>> models, std::span<MaterialInstance> material_variants);
+
+        const DrawContext &draw_context() const;
+
+        // NOTE: Changes whenever surfaces were added or removed, which invalidates every offset into the draw context
+        uint64_t layout_version() const;
+        // NOTE: The opaque surfaces whose transforms were patched by the last sync without a layout change
+        const std::vector<SurfaceRange> &moved_opaque_surfaces() const;
+
+    private:
+        // NOTE: The surfaces of the model relative to the entity, their offsets point into the draw context
+        struct Record
+        {
+            DrawContext local_surfaces;
+            uint32_t opaque_offset = 0;
+            uint32_t transparent_offset = 0;
+        };
+
+    private:
+        void on_model_change(entt::registry &registry, entt::entity entity);
+        void on_model_destroy(entt::registry &registry, entt::entity entity);
+        void on_world_transform_destroy(entt::registry &registry, entt::entity entity);
+
+        void rebuild_draw_context();
+        void update_transforms(entt::entity entity, const Record &record);
+
+    private:
+        entt::registry &m_registry;
+        const TransformHierarchy &m_transform_hierarchy;
+
+        std::unordered_map<entt::entity, Record> m_records;
+        std::vector<entt::entity> m_changed_entities;
+        std::vector<entt::entity> m_moved_entities;
+        bool m_layout_dirty = false;
+        uint64_t m_layout_version = 0;
+        std::vector<SurfaceRange> m_moved_opaque_surfaces;
+
+        DrawContext m_draw_context;
+    };
+} // namespace hyper_engine
\ No newline at end of file
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <hyper_core/ref_ptr.hpp>
+#include <hyper_rhi/format.hpp>
 #include <hyper_rhi/forward.hpp>
 #include <hyper_rhi/shader_module.hpp>
 #include <hyper_rhi/render_pipeline.hpp>
@@ -19,17 +20,15 @@ namespace hyper_engine
     public:
         GridPass(
             const ShaderCompiler &shader_compiler,
-            const RefPtr<Texture> &render_texture,
+            Format render_format,
             const RefPtr<TextureView> &render_texture_view,
-            const RefPtr<Texture> &depth_texture,
+            Format depth_format,
             const RefPtr<TextureView> &depth_texture_view);
 
         void render(const RefPtr<CommandList> &command_list) const;
 
     private:
-        const RefPtr<Texture> &m_render_texture;
         const RefPtr<TextureView> &m_render_texture_view;
-        const RefPtr<Texture> &m_depth_texture;
         const RefPtr<TextureView> &m_depth_texture_view;
 
         RefPtr<PipelineLayout> m_pipeline_layout;
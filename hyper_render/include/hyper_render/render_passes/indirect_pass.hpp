@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include <hyper_core/bounds.hpp>
+#include <hyper_core/ref_ptr.hpp>
+#include <hyper_rhi/forward.hpp>
+#include <hyper_rhi/render_pass.hpp>
+
+struct ShaderCluster;
+struct ShaderObject;
+
+namespace hyper_engine
+{
+    class GeometryArena;
+    class RenderObjectTable;
+    struct RenderObject;
+
+    // NOTE: GPU driven path for the opaque surfaces. The surfaces live in a persistent scene buffer, which is only patched when they
+    //       move, and a compute pass culls their meshlets by frustum and normal cone into compacted indirect draws. The CPU records one
+    //       multi draw per bucket of surfaces sharing a pipeline and index buffer, no matter how many objects the scene contains.
+    class IndirectPass
+    {
+    public:
+        static constexpr uint32_t s_group_size = 64;
+
+    public:
+        IndirectPass(
+            const ShaderCompiler &shader_compiler,
+            const RefPtr<TextureView> &render_texture_view,
+            const RefPtr<TextureView> &depth_texture_view,
+            const RefPtr<Buffer> &scene_buffer,
+            const RefPtr<GeometryArena> &geometry_arena);
+        ~IndirectPass();
+
+        void render(const RefPtr<CommandList> &command_list, const RenderObjectTable &render_objects, const Frustum &frustum);
+
+    private:
+        struct DrawBucket
+        {
+            RefPtr<RenderPipeline> pipeline;
+            RefPtr<Buffer> index_buffer;
+            IndexFormat index_format = IndexFormat::Uint32;
+            uint32_t command_offset = 0;
+            uint32_t command_capacity = 0;
+        };
+
+    private:
+        void rebuild_objects(const RefPtr<CommandList> &command_list, std::span<const RenderObject> render_objects);
+        void update_objects(const RefPtr<CommandList> &command_list, const RenderObjectTable &render_objects);
+
+        void cull(const RefPtr<CommandList> &command_list, const Frustum &frustum);
+        void draw(const RefPtr<CommandList> &command_list) const;
+
+    private:
+        const RefPtr<TextureView> &m_render_texture_view;
+        const RefPtr<TextureView> &m_depth_texture_view;
+        const RefPtr<Buffer> &m_scene_buffer;
+        const RefPtr<GeometryArena> &m_geometry_arena;
+
+        RefPtr<PipelineLayout> m_cull_pipeline_layout;
+        RefPtr<ShaderModule> m_cull_shader;
+        RefPtr<ComputePipeline> m_cull_pipeline;
+
+        uint64_t m_layout_version = std::numeric_limits<uint64_t>::max();
+        std::vector<ShaderObject> m_objects;
+        std::vector<ShaderCluster> m_clusters;
+        std::vector<DrawBucket> m_buckets;
+
+        RefPtr<Buffer> m_frustum_buffer;
+        RefPtr<Buffer> m_object_buffer;
+        RefPtr<Buffer> m_cluster_buffer;
+        RefPtr<Buffer> m_bucket_offset_buffer;
+        RefPtr<Buffer> m_draw_count_buffer;
+        RefPtr<Buffer> m_draw_command_buffer;
+        RefPtr<Buffer> m_visible_object_buffer;
+    };
+} // namespace hyper_engine
\ No newline at end of file
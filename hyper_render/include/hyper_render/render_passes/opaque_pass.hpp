@@ -6,26 +6,75 @@
 
 #pragma once
 
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include <hyper_core/math.hpp>
+#include <hyper_core/radix_sort.hpp>
 #include <hyper_core/ref_ptr.hpp>
 #include <hyper_rhi/forward.hpp>
+#include <hyper_rhi/render_pass.hpp>
 
 namespace hyper_engine
 {
     struct DrawContext;
+    class GeometryArena;
+    struct RenderObject;
 
     class OpaquePass
     {
+    public:
+        // NOTE: Minimum number of batches recorded by one secondary, smaller frames are recorded on the calling thread
+        static constexpr uint32_t s_secondary_batch_count = 1024;
+
     public:
         OpaquePass(
             const RefPtr<TextureView> &render_texture_view,
             const RefPtr<TextureView> &depth_texture_view,
-            const RefPtr<Buffer> &scene_buffer);
+            const RefPtr<Buffer> &scene_buffer,
+            const RefPtr<GeometryArena> &geometry_arena);
+
+        void render(
+            const RefPtr<CommandList> &command_list,
+            const DrawContext &draw_context,
+            const glm::vec3 &camera_position,
+            LoadOperation load_operation);
+
+    private:
+        // NOTE: Render objects sharing the same mesh surface and material, drawn with one instanced draw
+        struct DrawBatch
+        {
+            const RenderObject *render_object = nullptr;
+            uint32_t first_instance = 0;
+            uint32_t instance_count = 0;
+        };
 
-        void render(const RefPtr<CommandList> &command_list, const DrawContext &draw_context) const;
+    private:
+        void build_batches(std::span<const RenderObject> render_objects, bool transparent);
+        uint64_t sort_key(const RenderObject &render_object, bool transparent);
+        void upload_instances(const RefPtr<CommandList> &command_list);
+        void record_batches(RenderPass &render_pass, std::span<const DrawBatch> batches) const;
 
     private:
         const RefPtr<TextureView> &m_render_texture_view;
         const RefPtr<TextureView> &m_depth_texture_view;
         const RefPtr<Buffer> &m_scene_buffer;
+        const RefPtr<GeometryArena> &m_geometry_arena;
+
+        glm::vec3 m_camera_position = {0.0f, 0.0f, 0.0f};
+
+        // NOTE: Compact ids for the sort keys, handed out in first seen order and reset every frame
+        std::unordered_map<const void *, uint32_t> m_pipeline_ids;
+        std::unordered_map<const void *, uint32_t> m_material_ids;
+        std::unordered_map<const void *, uint32_t> m_mesh_ids;
+        std::unordered_map<uint64_t, uint32_t> m_surface_ids;
+
+        std::vector<SortEntry> m_sort_entries;
+        std::vector<SortEntry> m_sort_scratch;
+        std::vector<DrawBatch> m_batches;
+        std::vector<glm::mat4> m_instances;
+        RefPtr<Buffer> m_instance_buffer;
     };
 } // namespace hyper_engine
\ No newline at end of file
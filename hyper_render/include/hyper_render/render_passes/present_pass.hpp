@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <hyper_core/ref_ptr.hpp>
+#include <hyper_rhi/format.hpp>
+#include <hyper_rhi/forward.hpp>
+
+namespace hyper_engine
+{
+    // NOTE: Converts the render target into the format of the surface, a plain copy would reinterpret the texels of other formats
+    class PresentPass
+    {
+    public:
+        PresentPass(
+            const ShaderCompiler &shader_compiler,
+            const RefPtr<TextureView> &render_texture_view,
+            Format output_format,
+            const RefPtr<TextureView> &output_texture_view);
+
+        void render(const RefPtr<CommandList> &command_list) const;
+
+    private:
+        const RefPtr<TextureView> &m_render_texture_view;
+        const RefPtr<TextureView> &m_output_texture_view;
+
+        RefPtr<PipelineLayout> m_pipeline_layout;
+        RefPtr<ShaderModule> m_vertex_shader;
+        RefPtr<ShaderModule> m_fragment_shader;
+        RefPtr<RenderPipeline> m_pipeline;
+    };
+} // namespace hyper_engine
\ No newline at end of file
@@ -6,9 +6,11 @@
 
 #pragma once
 
+#include <span>
 #include <string>
 #include <vector>
 
+#include <hyper_core/bounds.hpp>
 #include <hyper_core/math.hpp>
 #include <hyper_rhi/forward.hpp>
 
@@ -23,11 +25,17 @@ namespace hyper_engine
         uint32_t index_count = 0;
         uint32_t first_index = 0;
         RefPtr<Buffer> index_buffer;
+        IndexFormat index_format = IndexFormat::Uint32;
 
         MaterialInstance *material = nullptr;
 
         glm::mat4 transform;
-        RefPtr<Buffer> mesh_buffer;
+        // NOTE: The surface bounds transformed by the transform above
+        BoundingBox bounds;
+        uint32_t mesh_id = 0;
+
+        // NOTE: Points into the surface of the mesh, which outlives every render object referencing it
+        std::span<const GltfMeshlet> meshlets;
     };
 
     struct DrawContext
@@ -94,12 +102,20 @@ namespace hyper_engine
         std::vector<RefPtr<Sampler>> m_samplers;
     };
 
+    struct GltfImportOptions
+    {
+        // NOTE: Welds duplicate vertices and reorders every primitive with meshoptimizer, which only costs import time
+        bool optimize_meshes = true;
+    };
+
     RefPtr<LoadedGltf> load_gltf(
         const RefPtr<CommandList> &command_list,
+        const RefPtr<GeometryArena> &geometry_arena,
         const RefPtr<TextureView> &white_texture_view,
         const RefPtr<Texture> &error_texture,
         const RefPtr<TextureView> &error_texture_view,
         const RefPtr<Sampler> &default_sampler_linear,
         const GltfMetallicRoughness &metallic_roughness_material,
-        const std::string &path);
+        const std::string &path,
+        const GltfImportOptions &import_options);
 } // namespace hyper_engine
\ No newline at end of file
@@ -6,39 +6,67 @@
 
 #pragma once
 
-#include <unordered_map>
+#include <array>
+#include <span>
+#include <vector>
 
+#include <hyper_core/bounds.hpp>
+#include <hyper_core/frustum_culling.hpp>
 #include <hyper_core/own_ptr.hpp>
+#include <hyper_event/subscription_handle.hpp>
 #include <hyper_platform/forward.hpp>
+#include <hyper_rhi/format.hpp>
 #include <hyper_rhi/forward.hpp>
 #include <hyper_rhi/graphics_device.hpp>
 #include <hyper_rhi/shader_compiler.hpp>
 
 #include "hyper_render/camera.hpp"
+#include "hyper_render/render_graph.hpp"
 #include "hyper_render/renderable.hpp"
 
 namespace hyper_engine
 {
     class EventBus;
     class GridPass;
+    class IndirectPass;
     class OpaquePass;
+    class PresentPass;
+
+    struct RendererDescriptor
+    {
+        // NOTE: Models are loaded in the order of the model list, the first material is the one of the model itself
+        uint32_t model_count = 1;
+        uint32_t material_count = 1;
+    };
 
     class Renderer
     {
     public:
-        Renderer();
+        static constexpr Format s_render_format = Format::Bgra8Unorm;
+        static constexpr Format s_depth_format = Format::D32Sfloat;
+
+        // FIXME: Remove this once models are assets
+        static constexpr std::array<const char *, 2> s_model_paths = {
+            "./assets/models/DamagedHelmet.glb",
+            "./assets/models/sponza/Sponza.gltf",
+        };
+
+    public:
+        explicit Renderer(const RendererDescriptor &descriptor);
         ~Renderer();
 
         void begin_frame(const CameraData &camera);
         void end_frame();
         void present() const;
 
-        void render_scene(const Scene &scene);
+        void render_scene(Scene &scene);
+
+        void set_gpu_driven(bool gpu_driven);
 
         static Renderer *&get();
 
     private:
-        void create_textures(uint32_t width, uint32_t height);
+        void cull_render_objects(std::span<const RenderObject> render_objects, std::vector<RenderObject> &visible_render_objects);
 
         void on_resize(const WindowResizeEvent &event);
 
@@ -47,15 +75,20 @@ namespace hyper_engine
         ShaderCompiler m_shader_compiler;
         RefPtr<CommandList> m_command_list;
 
+        // NOTE: Transient textures of the render graph, which are replaced whenever the graph recreates them
         RefPtr<Texture> m_render_texture;
         RefPtr<TextureView> m_render_texture_view;
         RefPtr<Texture> m_depth_texture;
         RefPtr<TextureView> m_depth_texture_view;
+        RefPtr<Texture> m_output_texture;
+        RefPtr<TextureView> m_output_texture_view;
 
         RefPtr<Buffer> m_camera_buffer;
 
         RefPtr<Buffer> m_scene_buffer;
 
+        RefPtr<GeometryArena> m_geometry_arena;
+
         RefPtr<Texture> m_white_texture;
         RefPtr<TextureView> m_white_texture_view;
         RefPtr<Texture> m_error_texture;
@@ -65,12 +98,25 @@ namespace hyper_engine
 
         GltfMetallicRoughness m_metallic_roughness_material;
 
-        DrawContext m_draw_context;
-        std::unordered_map<std::string, RefPtr<LoadedGltf>> m_scenes;
+        std::vector<RefPtr<LoadedGltf>> m_models;
+        // NOTE: Tinted copies of the default material, which replace the materials of the model for material indices above zero
+        std::vector<MaterialInstance> m_material_variants;
 
+        Frustum m_frustum;
+        glm::vec3 m_camera_position = {0.0f, 0.0f, 0.0f};
+        BoundingBoxBatch m_cull_boxes;
+        std::vector<uint8_t> m_visibility;
+        DrawContext m_visible_draw_context;
+
+        RenderGraph m_render_graph;
         OwnPtr<OpaquePass> m_opaque_pass;
+        OwnPtr<IndirectPass> m_indirect_pass;
         OwnPtr<GridPass> m_grid_pass;
+        OwnPtr<PresentPass> m_present_pass;
 
+        bool m_gpu_driven = false;
         uint32_t m_frame_index = 1;
+
+        SubscriptionHandle m_resize_subscription;
     };
 } // namespace hyper_engine
\ No newline at end of file
@@ -8,15 +8,36 @@
 
 #include <entt/entt.hpp>
 
+#include <hyper_ecs/spatial_index.hpp>
+#include <hyper_ecs/transform_hierarchy.hpp>
+
+#include "hyper_render/render_object_table.hpp"
+
 namespace hyper_engine
 {
     class Scene
     {
     public:
+        Scene();
+
+        void update();
+
         entt::registry &registry();
         const entt::registry &registry() const;
 
+        TransformHierarchy &transform_hierarchy();
+        const TransformHierarchy &transform_hierarchy() const;
+
+        SpatialIndex &spatial_index();
+        const SpatialIndex &spatial_index() const;
+
+        RenderObjectTable &render_objects();
+        const RenderObjectTable &render_objects() const;
+
     private:
         entt::registry m_registry;
+        TransformHierarchy m_transform_hierarchy;
+        SpatialIndex m_spatial_index;
+        RenderObjectTable m_render_objects;
     };
 } // namespace hyper_engine
\ No newline at end of file
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include "hyper_render/forward.hpp"
+
+namespace hyper_engine
+{
+    // NOTE: The binary format stores every component type as one contiguous column, so loading is a bulk insertion per column
+    //       straight out of the mapped file. Only entities with a transform are part of the scene.
+    class SceneSerializer
+    {
+    public:
+        static constexpr uint32_t s_magic = 0x43534548;
+        static constexpr uint32_t s_version = 1;
+        static constexpr uint64_t s_column_alignment = 16;
+
+        enum class Column : uint32_t
+        {
+            Transform,
+            Hierarchy,
+            Model,
+        };
+
+        struct FileHeader
+        {
+            uint32_t magic = s_magic;
+            uint32_t version = s_version;
+            uint32_t entity_count = 0;
+            uint32_t column_count = 0;
+        };
+
+        struct ColumnHeader
+        {
+            Column column = Column::Transform;
+            uint32_t element_size = 0;
+            uint32_t count = 0;
+            uint32_t padding = 0;
+            uint64_t entities_offset = 0;
+            uint64_t data_offset = 0;
+        };
+
+    public:
+        static bool save(const Scene &scene, std::string_view path);
+        static bool load(Scene &scene, std::string_view path);
+
+        static bool export_text(const Scene &scene, std::string_view path);
+    };
+} // namespace hyper_engine
\ No newline at end of file
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <hyper_core/ref_ptr.hpp>
+#include <hyper_rhi/forward.hpp>
+#include <hyper_rhi/texture.hpp>
+
+namespace hyper_engine
+{
+    // NOTE: The lifetime is the range of render graph levels in which the texture is accessed
+    struct TransientTextureRequest
+    {
+        TextureDescriptor descriptor;
+        uint32_t first_level = 0;
+        uint32_t last_level = 0;
+
+        bool operator==(const TransientTextureRequest &other) const = default;
+    };
+
+    struct TransientTexture
+    {
+        RefPtr<Texture> texture;
+        RefPtr<TextureView> texture_view;
+        // NOTE: Earlier textures sharing memory with this one, their accesses have to finish before this texture is first used
+        std::vector<uint32_t> aliased_textures;
+    };
+
+    // NOTE: Places textures with disjoint lifetimes at overlapping ranges of shared heaps. Textures with the transient usage get
+    //       their own lazily allocated memory instead. The placement is kept as long as the requests don't change.
+    class TransientResourceAllocator
+    {
+    public:
+        std::span<const TransientTexture> allocate(std::span<const TransientTextureRequest> requests);
+
+    private:
+        struct HeapPlacement
+        {
+            uint32_t memory_type_bits = 0;
+            uint64_t alignment = 1;
+            uint64_t byte_size = 0;
+            std::vector<uint32_t> textures;
+        };
+
+    private:
+        void place_textures(std::span<const TransientTextureRequest> requests);
+
+        static RefPtr<TextureView> create_texture_view(const RefPtr<Texture> &texture);
+
+    private:
+        std::vector<TransientTextureRequest> m_requests;
+        std::vector<RefPtr<TextureHeap>> m_heaps;
+        std::vector<TransientTexture> m_textures;
+    };
+} // namespace hyper_engine
\ No newline at end of file
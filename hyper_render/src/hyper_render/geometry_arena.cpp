@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_render/geometry_arena.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <hyper_core/assertion.hpp>
+#include <hyper_core/metrics.hpp>
+#include <hyper_rhi/buffer.hpp>
+#include <hyper_rhi/command_list.hpp>
+#include <hyper_rhi/graphics_device.hpp>
+
+#include "shader_interop.h"
+
+namespace hyper_engine
+{
+    static RefPtr<Buffer> create_vertex_buffer(const std::string &label, const uint64_t byte_size)
+    {
+        return GraphicsDevice::get()->create_buffer({
+            .label = label,
+            .byte_size = byte_size,
+            .usage = {BufferUsage::Storage, BufferUsage::ShaderResource},
+        });
+    }
+
+    static uint64_t index_size(const IndexFormat format)
+    {
+        return format == IndexFormat::Uint16 ? sizeof(uint16_t) : sizeof(uint32_t);
+    }
+
+    GeometryArena::GeometryArena()
+        : m_mesh_buffer(create_vertex_buffer("Geometry Meshes", s_mesh_capacity * sizeof(ShaderMesh)))
+        , m_mesh_allocator(s_mesh_capacity)
+    {
+    }
+
+    GeometryRange GeometryArena::allocate_vertices(const uint32_t count)
+    {
+        HE_ASSERT(count > 0);
+
+        for (size_t page = 0; page < m_vertex_pages.size(); ++page)
+        {
+            const uint64_t offset = m_vertex_pages[page].allocator.allocate(count);
+            if (offset != OffsetAllocator::s_invalid_offset)
+            {
+                return {
+                    .page = static_cast<uint32_t>(page),
+                    .offset = static_cast<uint32_t>(offset),
+                    .count = count,
+                };
+            }
+        }
+
+        // NOTE: Meshes larger than a page get a page of their own
+        const uint32_t capacity = std::max(s_vertex_page_capacity, count);
+        const size_t page = m_vertex_pages.size();
+        m_vertex_pages.push_back({
+            .positions_buffer = create_vertex_buffer(fmt::format("Geometry Positions {}", page), capacity * sizeof(glm::uvec2)),
+            .normals_buffer = create_vertex_buffer(fmt::format("Geometry Normals {}", page), capacity * sizeof(uint32_t)),
+            .colors_buffer = create_vertex_buffer(fmt::format("Geometry Colors {}", page), capacity * sizeof(uint32_t)),
+            .tex_coords_buffer = create_vertex_buffer(fmt::format("Geometry Tex Coords {}", page), capacity * sizeof(uint32_t)),
+            .allocator = OffsetAllocator(capacity),
+        });
+        update_metrics();
+
+        const uint64_t offset = m_vertex_pages.back().allocator.allocate(count);
+        HE_ASSERT(offset != OffsetAllocator::s_invalid_offset);
+
+        return {
+            .page = static_cast<uint32_t>(page),
+            .offset = static_cast<uint32_t>(offset),
+            .count = count,
+        };
+    }
+
+    GeometryRange GeometryArena::allocate_indices(const IndexFormat format, const uint32_t count)
+    {
+        HE_ASSERT(count > 0);
+
+        for (size_t page = 0; page < m_index_pages.size(); ++page)
+        {
+            if (m_index_pages[page].format != format)
+            {
+                continue;
+            }
+
+            const uint64_t offset = m_index_pages[page].allocator.allocate(count);
+            if (offset != OffsetAllocator::s_invalid_offset)
+            {
+                return {
+                    .page = static_cast<uint32_t>(page),
+                    .offset = static_cast<uint32_t>(offset),
+                    .count = count,
+                };
+            }
+        }
+
+        const uint32_t capacity = std::max(s_index_page_capacity, count);
+        const size_t page = m_index_pages.size();
+        m_index_pages.push_back({
+            .format = format,
+            .buffer = GraphicsDevice::get()->create_buffer({
+                .label = fmt::format("Geometry Indices {}", page),
+                .byte_size = capacity * index_size(format),
+                .usage = BufferUsage::Index,
+            }),
+            .allocator = OffsetAllocator(capacity),
+        });
+        update_metrics();
+
+        const uint64_t offset = m_index_pages.back().allocator.allocate(count);
+        HE_ASSERT(offset != OffsetAllocator::s_invalid_offset);
+
+        return {
+            .page = static_cast<uint32_t>(page),
+            .offset = static_cast<uint32_t>(offset),
+            .count = count,
+        };
+    }
+
+    uint32_t GeometryArena::allocate_mesh()
+    {
+        const uint64_t mesh_id = m_mesh_allocator.allocate(1);
+        HE_ASSERT(mesh_id != OffsetAllocator::s_invalid_offset, "The geometry arena ran out of mesh ids");
+
+        return static_cast<uint32_t>(mesh_id);
+    }
+
+    void GeometryArena::begin_frame(const uint32_t frame_index)
+    {
+        m_frame_index = frame_index;
+
+        PendingFrees &pending_frees = m_pending_frees[m_frame_index % GraphicsDevice::s_frame_count];
+        for (const GeometryRange &range : pending_frees.vertex_ranges)
+        {
+            m_vertex_pages[range.page].allocator.free(range.offset, range.count);
+        }
+
+        for (const GeometryRange &range : pending_frees.index_ranges)
+        {
+            m_index_pages[range.page].allocator.free(range.offset, range.count);
+        }
+
+        for (const uint32_t mesh_id : pending_frees.mesh_ids)
+        {
+            m_mesh_allocator.free(mesh_id, 1);
+        }
+
+        pending_frees.vertex_ranges.clear();
+        pending_frees.index_ranges.clear();
+        pending_frees.mesh_ids.clear();
+    }
+
+    void GeometryArena::free_vertices(const GeometryRange &range)
+    {
+        HE_ASSERT(range.page < m_vertex_pages.size());
+
+        m_pending_frees[m_frame_index % GraphicsDevice::s_frame_count].vertex_ranges.push_back(range);
+    }
+
+    void GeometryArena::free_indices(const GeometryRange &range)
+    {
+        HE_ASSERT(range.page < m_index_pages.size());
+
+        m_pending_frees[m_frame_index % GraphicsDevice::s_frame_count].index_ranges.push_back(range);
+    }
+
+    void GeometryArena::free_mesh(const uint32_t mesh_id)
+    {
+        HE_ASSERT(mesh_id < s_mesh_capacity);
+
+        m_pending_frees[m_frame_index % GraphicsDevice::s_frame_count].mesh_ids.push_back(mesh_id);
+    }
+
+    void GeometryArena::write_vertices(
+        const RefPtr<CommandList> &command_list,
+        const GeometryRange &range,
+        const std::span<const glm::uvec2> positions,
+        const std::span<const uint32_t> normals,
+        const std::span<const uint32_t> colors,
+        const std::span<const uint32_t> tex_coords) const
+    {
+        HE_ASSERT(positions.size() == range.count);
+        HE_ASSERT(normals.size() == range.count);
+        HE_ASSERT(colors.size() == range.count);
+        HE_ASSERT(tex_coords.size() == range.count);
+
+        const VertexPage &page = vertex_page(range.page);
+        command_list->write_buffer(page.positions_buffer, positions.data(), positions.size_bytes(), range.offset * sizeof(glm::uvec2));
+        command_list->write_buffer(page.normals_buffer, normals.data(), normals.size_bytes(), range.offset * sizeof(uint32_t));
+        command_list->write_buffer(page.colors_buffer, colors.data(), colors.size_bytes(), range.offset * sizeof(uint32_t));
+        command_list->write_buffer(page.tex_coords_buffer, tex_coords.data(), tex_coords.size_bytes(), range.offset * sizeof(uint32_t));
+    }
+
+    void GeometryArena::write_indices(
+        const RefPtr<CommandList> &command_list,
+        const GeometryRange &range,
+        const std::span<const uint32_t> indices) const
+    {
+        HE_ASSERT(indices.size() == range.count);
+
+        const IndexPage &page = index_page(range.page);
+        if (page.format == IndexFormat::Uint32)
+        {
+            command_list->write_buffer(page.buffer, indices.data(), indices.size_bytes(), range.offset * sizeof(uint32_t));
+            return;
+        }
+
+        std::vector<uint16_t> narrow_indices(indices.size());
+        std::ranges::transform(
+            indices,
+            narrow_indices.begin(),
+            [](const uint32_t index)
+            {
+                HE_ASSERT(index <= std::numeric_limits<uint16_t>::max());
+                return static_cast<uint16_t>(index);
+            });
+
+        command_list->write_buffer(
+            page.buffer,
+            narrow_indices.data(),
+            narrow_indices.size() * sizeof(uint16_t),
+            range.offset * sizeof(uint16_t));
+    }
+
+    void GeometryArena::write_mesh(const RefPtr<CommandList> &command_list, const uint32_t mesh_id, const ShaderMesh &mesh) const
+    {
+        HE_ASSERT(mesh_id < s_mesh_capacity);
+
+        command_list->write_buffer(m_mesh_buffer, &mesh, sizeof(ShaderMesh), mesh_id * sizeof(ShaderMesh));
+    }
+
+    const GeometryArena::VertexPage &GeometryArena::vertex_page(const uint32_t page) const
+    {
+        HE_ASSERT(page < m_vertex_pages.size());
+
+        return m_vertex_pages[page];
+    }
+
+    const GeometryArena::IndexPage &GeometryArena::index_page(const uint32_t page) const
+    {
+        HE_ASSERT(page < m_index_pages.size());
+
+        return m_index_pages[page];
+    }
+
+    RefPtr<Buffer> GeometryArena::mesh_buffer() const
+    {
+        return m_mesh_buffer;
+    }
+
+    void GeometryArena::update_metrics() const
+    {
+        static Gauge &buffer_gauge = MetricsRegistry::get()->gauge("render.geometry.buffers");
+
+        // NOTE: Every vertex page consists of one buffer per stream
+        buffer_gauge.set(static_cast<int64_t>(1 + m_vertex_pages.size() * 4 + m_index_pages.size()));
+    }
+} // namespace hyper_engine
\ No newline at end of file
@@ -23,10 +23,7 @@
 
 namespace hyper_engine
 {
-    GltfMetallicRoughness::GltfMetallicRoughness(
-        const ShaderCompiler &shader_compiler,
-        const RefPtr<Texture> &render_texture,
-        const RefPtr<Texture> &depth_texture)
+    GltfMetallicRoughness::GltfMetallicRoughness(const ShaderCompiler &shader_compiler, const Format render_format, const Format depth_format)
     {
         const RefPtr<ShaderModule> vertex_shader = GraphicsDevice::get()->create_shader_module({
             .label = "Mesh",
@@ -59,7 +56,7 @@ namespace hyper_engine
             .push_constant_size = sizeof(ObjectPushConstants),
         });
 
-        m_opaque_pipeline = GraphicsDevice::get()->create_render_pipeline({
+        RenderPipelineDescriptor opaque_pipeline_descriptor = {
             .label = "Opaque",
             .layout = pipeline_layout,
             .vertex_shader = vertex_shader,
@@ -67,7 +64,7 @@ namespace hyper_engine
             .color_attachment_states =
                 {
                     {
-                        .format = render_texture->format(),
+                        .format = render_format,
                         .blend_state =
                             {
                                 .blend_enable = false,
@@ -92,11 +89,48 @@ namespace hyper_engine
                 {
                     .depth_test_enable = true,
                     .depth_write_enable = true,
-                    .depth_format = depth_texture->format(),
+                    .depth_format = depth_format,
                     .depth_compare_operation = CompareOperation::Less,
                     .depth_bias_state = {},
                 },
+        };
+
+        m_opaque_pipeline = GraphicsDevice::get()->create_render_pipeline(opaque_pipeline_descriptor);
+
+        const RefPtr<ShaderModule> indirect_vertex_shader = GraphicsDevice::get()->create_shader_module({
+            .label = "Indirect Mesh",
+            .type = ShaderType::Vertex,
+            .entry_name = "vs_main",
+            .bytes = shader_compiler
+                         .compile({
+                             .type = ShaderType::Vertex,
+                             .entry_name = "vs_main",
+                             .data = filesystem::read_file("./assets/shaders/indirect_mesh_shader.hlsl"),
+                         })
+                         .spirv,
+        });
+
+        const RefPtr<ShaderModule> indirect_fragment_shader = GraphicsDevice::get()->create_shader_module({
+            .label = "Indirect Mesh",
+            .type = ShaderType::Fragment,
+            .entry_name = "fs_main",
+            .bytes = shader_compiler
+                         .compile({
+                             .type = ShaderType::Fragment,
+                             .entry_name = "fs_main",
+                             .data = filesystem::read_file("./assets/shaders/indirect_mesh_shader.hlsl"),
+                         })
+                         .spirv,
+        });
+
+        opaque_pipeline_descriptor.label = "Indirect Opaque";
+        opaque_pipeline_descriptor.layout = GraphicsDevice::get()->create_pipeline_layout({
+            .label = "Indirect Mesh",
+            .push_constant_size = sizeof(IndirectPushConstants),
         });
+        opaque_pipeline_descriptor.vertex_shader = indirect_vertex_shader;
+        opaque_pipeline_descriptor.fragment_shader = indirect_fragment_shader;
+        m_indirect_opaque_pipeline = GraphicsDevice::get()->create_render_pipeline(opaque_pipeline_descriptor);
 
         m_transparent_pipeline = GraphicsDevice::get()->create_render_pipeline({
             .label = "Transparent",
@@ -106,7 +140,7 @@ namespace hyper_engine
             .color_attachment_states =
                 {
                     {
-                        .format = render_texture->format(),
+                        .format = render_format,
                         .blend_state =
                             {
                                 .blend_enable = true,
@@ -132,7 +166,7 @@ namespace hyper_engine
                     .depth_test_enable = true,
                     .depth_write_enable = true,
                     // FIXME: Add 2nd pass for transparent stuff
-                    .depth_format = depth_texture->format(),
+                    .depth_format = depth_format,
                     .depth_compare_operation = CompareOperation::Less,
                     .depth_bias_state = {},
                 },
@@ -180,6 +214,7 @@ namespace hyper_engine
 
         const MaterialInstance material_instance = {
             .pipeline = pipeline,
+            .indirect_pipeline = pass_type == MaterialPassType::MainColor ? m_indirect_opaque_pipeline : nullptr,
             .pass_type = pass_type,
             .buffer = buffer,
         };
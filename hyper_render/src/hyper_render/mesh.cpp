@@ -6,6 +6,8 @@
 
 #include "hyper_render/mesh.hpp"
 
+#include <algorithm>
+
 #include <hyper_rhi/buffer.hpp>
 
 namespace hyper_engine
@@ -13,21 +15,36 @@ namespace hyper_engine
     Mesh::Mesh(
         std::string name,
         std::vector<GltfSurface> surfaces,
-        RefPtr<Buffer> positions_buffer,
-        RefPtr<Buffer> normals_buffer,
-        RefPtr<Buffer> colors_buffer,
-        RefPtr<Buffer> tex_coords_buffer,
-        RefPtr<Buffer> mesh_buffer,
-        RefPtr<Buffer> indices_buffer)
+        RefPtr<GeometryArena> geometry_arena,
+        const GeometryRange &vertex_range,
+        const GeometryRange &index_range,
+        const uint32_t mesh_id)
         : m_name(std::move(name))
         , m_surfaces(std::move(surfaces))
-        , m_positions_buffer(std::move(positions_buffer))
-        , m_normals_buffer(std::move(normals_buffer))
-        , m_colors_buffer(std::move(colors_buffer))
-        , m_tex_coords_buffer(std::move(tex_coords_buffer))
-        , m_mesh_buffer(std::move(mesh_buffer))
-        , m_indices_buffer(std::move(indices_buffer))
+        , m_geometry_arena(std::move(geometry_arena))
+        , m_vertex_range(vertex_range)
+        , m_index_range(index_range)
+        , m_mesh_id(mesh_id)
+    {
+        for (const GltfSurface &surface : m_surfaces)
+        {
+            m_bounds.merge(surface.bounds);
+        }
+
+        // NOTE: The sphere around the box center enclosing every surface sphere, slightly larger than the tightest sphere
+        m_bounding_sphere.center = m_bounds.is_valid() ? m_bounds.center() : glm::vec3(0.0f);
+        for (const GltfSurface &surface : m_surfaces)
+        {
+            const float radius = glm::length(surface.bounding_sphere.center - m_bounding_sphere.center) + surface.bounding_sphere.radius;
+            m_bounding_sphere.radius = std::max(m_bounding_sphere.radius, radius);
+        }
+    }
+
+    Mesh::~Mesh()
     {
+        m_geometry_arena->free_vertices(m_vertex_range);
+        m_geometry_arena->free_indices(m_index_range);
+        m_geometry_arena->free_mesh(m_mesh_id);
     }
 
     std::string_view Mesh::name() const
@@ -40,33 +57,38 @@ namespace hyper_engine
         return m_surfaces;
     }
 
-    RefPtr<Buffer> Mesh::positions_buffer() const
+    const BoundingBox &Mesh::bounds() const
+    {
+        return m_bounds;
+    }
+
+    const BoundingSphere &Mesh::bounding_sphere() const
     {
-        return m_positions_buffer;
+        return m_bounding_sphere;
     }
 
-    RefPtr<Buffer> Mesh::normals_buffer() const
+    const GeometryRange &Mesh::vertex_range() const
     {
-        return m_normals_buffer;
+        return m_vertex_range;
     }
 
-    RefPtr<Buffer> Mesh::colors_buffer() const
+    const GeometryRange &Mesh::index_range() const
     {
-        return m_colors_buffer;
+        return m_index_range;
     }
 
-    RefPtr<Buffer> Mesh::tex_coords_buffer() const
+    uint32_t Mesh::mesh_id() const
     {
-        return m_tex_coords_buffer;
+        return m_mesh_id;
     }
 
-    RefPtr<Buffer> Mesh::mesh_buffer() const
+    RefPtr<Buffer> Mesh::index_buffer() const
     {
-        return m_mesh_buffer;
+        return m_geometry_arena->index_page(m_index_range.page).buffer;
     }
 
-    RefPtr<Buffer> Mesh::indices_buffer() const
+    IndexFormat Mesh::index_format() const
     {
-        return m_indices_buffer;
+        return m_geometry_arena->index_page(m_index_range.page).format;
     }
 } // namespace hyper_engine
\ No newline at end of file
@@ -0,0 +1,563 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_render/render_graph.hpp"
+
+#include <algorithm>
+#include <span>
+#include <utility>
+
+#include <hyper_core/assertion.hpp>
+#include <hyper_core/metrics.hpp>
+#include <hyper_rhi/buffer.hpp>
+#include <hyper_rhi/texture_view.hpp>
+
+namespace hyper_engine
+{
+    static constexpr BitFlags<BarrierAccess> g_write_access = {
+        BarrierAccess::ShaderWrite,
+        BarrierAccess::ColorAttachmentWrite,
+        BarrierAccess::DepthStencilAttachmentWrite,
+        BarrierAccess::TransferWrite,
+    };
+
+    RenderGraphResource RenderGraph::import_texture(const RefPtr<Texture> &texture, const ResourceUsage final_usage)
+    {
+        HE_ASSERT(texture != nullptr);
+
+        // NOTE: Imported resources start without pending work, as the previous frame finished before recording starts
+        m_resources.push_back({
+            .texture = texture,
+            .texture_view = nullptr,
+            .buffer = nullptr,
+            .final_usage = final_usage,
+            .state = {},
+            .transient_index = std::numeric_limits<uint32_t>::max(),
+            .aliased_resources = {},
+        });
+
+        return {
+            .index = static_cast<uint32_t>(m_resources.size() - 1),
+        };
+    }
+
+    RenderGraphResource RenderGraph::import_buffer(const RefPtr<Buffer> &buffer, const ResourceUsage final_usage)
+    {
+        HE_ASSERT(buffer != nullptr);
+
+        m_resources.push_back({
+            .texture = nullptr,
+            .texture_view = nullptr,
+            .buffer = buffer,
+            .final_usage = final_usage,
+            .state = {},
+            .transient_index = std::numeric_limits<uint32_t>::max(),
+            .aliased_resources = {},
+        });
+
+        return {
+            .index = static_cast<uint32_t>(m_resources.size() - 1),
+        };
+    }
+
+    RenderGraphResource RenderGraph::create_texture(const TextureDescriptor &descriptor)
+    {
+        HE_ASSERT(!(descriptor.usage & TextureUsage::Transient));
+
+        m_transient_requests.push_back({
+            .descriptor = descriptor,
+            .first_level = 0,
+            .last_level = 0,
+        });
+        m_transient_resources.push_back(static_cast<uint32_t>(m_resources.size()));
+
+        // NOTE: The texture is only created once the lifetimes are known, which happens when compiling the graph
+        m_resources.push_back({
+            .texture = nullptr,
+            .texture_view = nullptr,
+            .buffer = nullptr,
+            .final_usage = ResourceUsage::None,
+            .state = {},
+            .transient_index = static_cast<uint32_t>(m_transient_requests.size() - 1),
+            .aliased_resources = {},
+        });
+
+        return {
+            .index = static_cast<uint32_t>(m_resources.size() - 1),
+        };
+    }
+
+    void RenderGraph::add_pass(RenderGraphPassDescriptor descriptor)
+    {
+        for (const RenderGraphAccess &access : descriptor.accesses)
+        {
+            HE_ASSERT(access.resource.index < m_resources.size());
+            HE_ASSERT(access.usage != ResourceUsage::None);
+        }
+
+        m_passes.push_back({
+            .descriptor = std::move(descriptor),
+            .level = 0,
+            .culled = false,
+        });
+    }
+
+    void RenderGraph::compile()
+    {
+        static Counter &culled_pass_counter = MetricsRegistry::get()->counter("render.graph.culled_passes");
+
+        HE_ASSERT(!m_compiled);
+
+        cull_passes();
+        schedule_passes();
+        allocate_transient_textures();
+
+        culled_pass_counter.add(m_passes.size() - m_schedule.size());
+
+        m_compiled = true;
+    }
+
+    void RenderGraph::execute(const RefPtr<CommandList> &command_list)
+    {
+        static Counter &barrier_batch_counter = MetricsRegistry::get()->counter("render.graph.barrier_batches");
+        static Counter &barrier_counter = MetricsRegistry::get()->counter("render.graph.barriers");
+
+        if (!m_compiled)
+        {
+            compile();
+        }
+
+        const auto insert_barriers = [&command_list](const Barriers &barriers)
+        {
+            const size_t barrier_count = barriers.buffer_memory_barriers.size() + barriers.texture_memory_barriers.size();
+            if (barrier_count == 0)
+            {
+                return;
+            }
+
+            command_list->insert_barriers(barriers);
+
+            barrier_batch_counter.add(1);
+            barrier_counter.add(barrier_count);
+        };
+
+        // NOTE: Every resource has at most one merged usage per level, as conflicting accesses always end up on different levels
+        std::vector<UsageInfo> level_usages(m_resources.size());
+        std::vector<uint32_t> level_resources;
+
+        size_t level_begin = 0;
+        while (level_begin < m_schedule.size())
+        {
+            const uint32_t level = m_passes[m_schedule[level_begin]].level;
+
+            size_t level_end = level_begin;
+            while (level_end < m_schedule.size() && m_passes[m_schedule[level_end]].level == level)
+            {
+                level_end += 1;
+            }
+
+            level_resources.clear();
+            for (size_t index = level_begin; index < level_end; ++index)
+            {
+                for (const RenderGraphAccess &access : m_passes[m_schedule[index]].descriptor.accesses)
+                {
+                    const UsageInfo usage = RenderGraph::usage_info(access.usage);
+
+                    UsageInfo &level_usage = level_usages[access.resource.index];
+                    if (std::ranges::find(level_resources, access.resource.index) == level_resources.end())
+                    {
+                        level_resources.push_back(access.resource.index);
+                        level_usage.layout = usage.layout;
+                    }
+
+                    HE_ASSERT(!m_resources[access.resource.index].texture || level_usage.layout == usage.layout);
+
+                    level_usage.stages |= usage.stages;
+                    level_usage.access |= usage.access;
+                    level_usage.write = level_usage.write || usage.write;
+                }
+            }
+
+            Barriers barriers = {};
+            for (const uint32_t resource_index : level_resources)
+            {
+                // NOTE: Aliased textures reuse the memory of earlier ones, whose accesses have to finish before the memory is reused
+                Resource &resource = m_resources[resource_index];
+                if (resource.transient_index != std::numeric_limits<uint32_t>::max() &&
+                    m_transient_requests[resource.transient_index].first_level == level)
+                {
+                    for (const uint32_t aliased_resource : resource.aliased_resources)
+                    {
+                        const ResourceState &aliased_state = m_resources[aliased_resource].state;
+                        resource.state.write_stages |= aliased_state.write_stages | aliased_state.read_stages;
+                        resource.state.write_access |= aliased_state.write_access;
+                    }
+                }
+
+                transition(resource, level_usages[resource_index], barriers);
+                level_usages[resource_index] = {};
+            }
+
+            insert_barriers(barriers);
+
+            for (size_t index = level_begin; index < level_end; ++index)
+            {
+                m_passes[m_schedule[index]].descriptor.execute(command_list);
+            }
+
+            level_begin = level_end;
+        }
+
+        Barriers final_barriers = {};
+        for (Resource &resource : m_resources)
+        {
+            if (resource.final_usage != ResourceUsage::None)
+            {
+                transition(resource, RenderGraph::usage_info(resource.final_usage), final_barriers);
+            }
+        }
+
+        insert_barriers(final_barriers);
+
+        m_resources.clear();
+        m_passes.clear();
+        m_schedule.clear();
+        m_compiled = false;
+
+        m_transient_requests.clear();
+        m_transient_resources.clear();
+    }
+
+    const RefPtr<Texture> &RenderGraph::texture(const RenderGraphResource resource) const
+    {
+        HE_ASSERT(m_compiled);
+        HE_ASSERT(resource.index < m_resources.size());
+
+        return m_resources[resource.index].texture;
+    }
+
+    const RefPtr<TextureView> &RenderGraph::texture_view(const RenderGraphResource resource) const
+    {
+        HE_ASSERT(m_compiled);
+        HE_ASSERT(resource.index < m_resources.size());
+        HE_ASSERT(m_resources[resource.index].transient_index != std::numeric_limits<uint32_t>::max());
+
+        return m_resources[resource.index].texture_view;
+    }
+
+    RenderGraph::UsageInfo RenderGraph::usage_info(const ResourceUsage usage)
+    {
+        switch (usage)
+        {
+        case ResourceUsage::None:
+            return {};
+        case ResourceUsage::ColorAttachment:
+            return {
+                .stages = BarrierPipelineStage::ColorAttachmentOutput,
+                .access = {BarrierAccess::ColorAttachmentRead, BarrierAccess::ColorAttachmentWrite},
+                .layout = BarrierTextureLayout::ColorAttachment,
+                .write = true,
+            };
+        case ResourceUsage::DepthStencilAttachment:
+            return {
+                .stages = {BarrierPipelineStage::EarlyFragmentTests, BarrierPipelineStage::LateFragmentTests},
+                .access = {BarrierAccess::DepthStencilAttachmentRead, BarrierAccess::DepthStencilAttachmentWrite},
+                .layout = BarrierTextureLayout::DepthStencilAttachment,
+                .write = true,
+            };
+        case ResourceUsage::ShaderRead:
+            return {
+                .stages = {BarrierPipelineStage::ComputeShader, BarrierPipelineStage::VertexShader, BarrierPipelineStage::FragmentShader},
+                .access = BarrierAccess::ShaderRead,
+                .layout = BarrierTextureLayout::ShaderReadOnly,
+                .write = false,
+            };
+        case ResourceUsage::ShaderWrite:
+            return {
+                .stages = BarrierPipelineStage::ComputeShader,
+                .access = {BarrierAccess::ShaderRead, BarrierAccess::ShaderWrite},
+                .layout = BarrierTextureLayout::General,
+                .write = true,
+            };
+        case ResourceUsage::IndirectRead:
+            return {
+                .stages = BarrierPipelineStage::DrawIndirect,
+                .access = BarrierAccess::IndirectCommandRead,
+                .layout = BarrierTextureLayout::Undefined,
+                .write = false,
+            };
+        case ResourceUsage::TransferRead:
+            return {
+                .stages = BarrierPipelineStage::AllTransfer,
+                .access = BarrierAccess::TransferRead,
+                .layout = BarrierTextureLayout::TransferSrc,
+                .write = false,
+            };
+        case ResourceUsage::TransferWrite:
+            return {
+                .stages = BarrierPipelineStage::AllTransfer,
+                .access = BarrierAccess::TransferWrite,
+                .layout = BarrierTextureLayout::TransferDst,
+                .write = true,
+            };
+        case ResourceUsage::Present:
+            return {
+                .stages = BarrierPipelineStage::None,
+                .access = BarrierAccess::None,
+                .layout = BarrierTextureLayout::Present,
+                .write = false,
+            };
+        default:
+            HE_UNREACHABLE();
+        }
+    }
+
+    // NOTE: Walks the passes backwards, a pass stays alive if something later needs one of the resources it accesses. Writes keep
+    //       earlier writers alive as well, since attachments load their previous contents.
+    void RenderGraph::cull_passes()
+    {
+        std::vector<bool> needed(m_resources.size(), false);
+        for (size_t index = 0; index < m_resources.size(); ++index)
+        {
+            needed[index] = m_resources[index].final_usage != ResourceUsage::None;
+        }
+
+        for (auto pass = m_passes.rbegin(); pass != m_passes.rend(); ++pass)
+        {
+            const bool writes_needed = std::ranges::any_of(
+                pass->descriptor.accesses,
+                [&needed](const RenderGraphAccess &access)
+                {
+                    return RenderGraph::usage_info(access.usage).write && needed[access.resource.index];
+                });
+
+            pass->culled = !pass->descriptor.side_effects && !writes_needed;
+            if (pass->culled)
+            {
+                continue;
+            }
+
+            for (const RenderGraphAccess &access : pass->descriptor.accesses)
+            {
+                needed[access.resource.index] = true;
+            }
+        }
+    }
+
+    // NOTE: A pass is placed one level after the latest pass it depends on. Reads depend on the last writer, writes on the last writer
+    //       and every reader since, and reads in another layout on the previous readers. Passes of one level don't depend on each other.
+    void RenderGraph::schedule_passes()
+    {
+        struct ResourceTracking
+        {
+            uint32_t last_writer = std::numeric_limits<uint32_t>::max();
+            std::vector<uint32_t> readers;
+            BarrierTextureLayout read_layout = BarrierTextureLayout::Undefined;
+        };
+
+        std::vector<ResourceTracking> trackings(m_resources.size());
+
+        for (uint32_t pass_index = 0; pass_index < m_passes.size(); ++pass_index)
+        {
+            Pass &pass = m_passes[pass_index];
+            if (pass.culled)
+            {
+                continue;
+            }
+
+            pass.level = 0;
+            for (const RenderGraphAccess &access : pass.descriptor.accesses)
+            {
+                const UsageInfo usage = RenderGraph::usage_info(access.usage);
+                const ResourceTracking &tracking = trackings[access.resource.index];
+
+                if (tracking.last_writer != std::numeric_limits<uint32_t>::max())
+                {
+                    pass.level = std::max(pass.level, m_passes[tracking.last_writer].level + 1);
+                }
+
+                const bool layout_conflict = m_resources[access.resource.index].is_texture() && usage.layout != tracking.read_layout;
+                if (usage.write || layout_conflict)
+                {
+                    for (const uint32_t reader : tracking.readers)
+                    {
+                        pass.level = std::max(pass.level, m_passes[reader].level + 1);
+                    }
+                }
+            }
+
+            for (const RenderGraphAccess &access : pass.descriptor.accesses)
+            {
+                const UsageInfo usage = RenderGraph::usage_info(access.usage);
+                ResourceTracking &tracking = trackings[access.resource.index];
+
+                if (usage.write)
+                {
+                    tracking.last_writer = pass_index;
+                    tracking.readers.clear();
+                    continue;
+                }
+
+                // NOTE: Readers in another layout are already ordered before this one, later writers depend on them through it
+                if (m_resources[access.resource.index].is_texture() && tracking.read_layout != usage.layout)
+                {
+                    tracking.readers.clear();
+                    tracking.read_layout = usage.layout;
+                }
+
+                tracking.readers.push_back(pass_index);
+            }
+
+            m_schedule.push_back(pass_index);
+        }
+
+        std::ranges::stable_sort(
+            m_schedule,
+            [this](const uint32_t lhs, const uint32_t rhs)
+            {
+                return m_passes[lhs].level < m_passes[rhs].level;
+            });
+    }
+
+    // NOTE: The lifetime of a transient texture spans the levels of the passes accessing it, textures used by a single pass only as
+    //       attachments never have to be stored and can live in lazily allocated memory
+    void RenderGraph::allocate_transient_textures()
+    {
+        constexpr uint32_t no_pass = std::numeric_limits<uint32_t>::max();
+
+        std::vector<uint32_t> single_passes(m_transient_requests.size(), no_pass);
+        std::vector<bool> attachment_only(m_transient_requests.size(), true);
+        std::vector<bool> accessed(m_transient_requests.size(), false);
+
+        for (const uint32_t pass_index : m_schedule)
+        {
+            const Pass &pass = m_passes[pass_index];
+            for (const RenderGraphAccess &access : pass.descriptor.accesses)
+            {
+                const uint32_t transient_index = m_resources[access.resource.index].transient_index;
+                if (transient_index == std::numeric_limits<uint32_t>::max())
+                {
+                    continue;
+                }
+
+                TransientTextureRequest &request = m_transient_requests[transient_index];
+                if (!accessed[transient_index])
+                {
+                    request.first_level = pass.level;
+                    request.last_level = pass.level;
+                    single_passes[transient_index] = pass_index;
+                    accessed[transient_index] = true;
+                }
+
+                request.last_level = std::max(request.last_level, pass.level);
+
+                if (single_passes[transient_index] != pass_index)
+                {
+                    single_passes[transient_index] = no_pass;
+                }
+
+                if (access.usage != ResourceUsage::ColorAttachment && access.usage != ResourceUsage::DepthStencilAttachment)
+                {
+                    attachment_only[transient_index] = false;
+                }
+            }
+        }
+
+        for (size_t transient_index = 0; transient_index < m_transient_requests.size(); ++transient_index)
+        {
+            TextureDescriptor &descriptor = m_transient_requests[transient_index].descriptor;
+            if (single_passes[transient_index] != no_pass && attachment_only[transient_index] &&
+                descriptor.usage == TextureUsage::RenderAttachment)
+            {
+                descriptor.usage |= TextureUsage::Transient;
+            }
+        }
+
+        const std::span<const TransientTexture> textures = m_transient_allocator.allocate(m_transient_requests);
+        for (size_t transient_index = 0; transient_index < textures.size(); ++transient_index)
+        {
+            Resource &resource = m_resources[m_transient_resources[transient_index]];
+            resource.texture = textures[transient_index].texture;
+            resource.texture_view = textures[transient_index].texture_view;
+
+            for (const uint32_t aliased_texture : textures[transient_index].aliased_textures)
+            {
+                resource.aliased_resources.push_back(m_transient_resources[aliased_texture]);
+            }
+        }
+    }
+
+    void RenderGraph::transition(Resource &resource, const UsageInfo &usage, Barriers &barriers) const
+    {
+        ResourceState &state = resource.state;
+
+        const auto add_barrier = [&resource, &usage, &barriers](
+                                     const BitFlags<BarrierPipelineStage> stage_before,
+                                     const BitFlags<BarrierAccess> access_before,
+                                     const BarrierTextureLayout layout_before)
+        {
+            if (resource.texture)
+            {
+                barriers.texture_memory_barriers.push_back({
+                    .stage_before = stage_before,
+                    .stage_after = usage.stages,
+                    .access_before = access_before,
+                    .access_after = usage.access,
+                    .layout_before = layout_before,
+                    .layout_after = usage.layout,
+                    .texture = resource.texture,
+                    .subresource_range =
+                        {
+                            .base_mip_level = 0,
+                            .mip_level_count = resource.texture->mip_levels(),
+                            .base_array_level = 0,
+                            .array_layer_count = resource.texture->array_size(),
+                        },
+                });
+                return;
+            }
+
+            barriers.buffer_memory_barriers.push_back({
+                .stage_before = stage_before,
+                .stage_after = usage.stages,
+                .access_before = access_before,
+                .access_after = usage.access,
+                .buffer = resource.buffer,
+            });
+        };
+
+        const bool layout_change = resource.texture && state.layout != usage.layout;
+        if (usage.write || layout_change)
+        {
+            // NOTE: Reads only need an execution dependency, writes have to be made available as well
+            const BitFlags<BarrierPipelineStage> stage_before = state.write_stages | state.read_stages;
+            if (layout_change || stage_before)
+            {
+                add_barrier(stage_before, state.write_access, state.layout);
+            }
+
+            // NOTE: A layout transition is a write of its own, which is only visible to the stages of the barrier
+            state.layout = usage.layout;
+            state.write_stages = usage.stages;
+            state.write_access = usage.access & g_write_access;
+            state.read_stages = usage.write ? BarrierPipelineStage::None : usage.stages;
+            state.visible_stages = usage.write ? BarrierPipelineStage::None : usage.stages;
+            state.visible_access = usage.write ? BarrierAccess::None : usage.access;
+            return;
+        }
+
+        const bool hidden = (usage.stages & ~state.visible_stages) || (usage.access & ~state.visible_access);
+        if (state.write_stages && hidden)
+        {
+            add_barrier(state.write_stages, state.write_access, state.layout);
+
+            state.visible_stages |= usage.stages;
+            state.visible_access |= usage.access;
+        }
+
+        state.read_stages |= usage.stages;
+    }
+} // namespace hyper_engine
\ No newline at end of file
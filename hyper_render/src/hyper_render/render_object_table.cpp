@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_render/render_object_table.hpp"
+
+#include <hyper_core/assertion.hpp>
+#include <hyper_core/prerequisites.hpp>
+#include <hyper_ecs/bounds_component.hpp>
+#include <hyper_ecs/model_component.hpp>
+#include <hyper_ecs/transform_hierarchy.hpp>
+#include <hyper_ecs/world_transform_component.hpp>
+
+namespace hyper_engine
+{
+    RenderObjectTable::RenderObjectTable(entt::registry &registry, const TransformHierarchy &transform_hierarchy)
+        : m_registry(registry)
+        , m_transform_hierarchy(transform_hierarchy)
+    {
+        m_registry.on_construct<ModelComponent>().connect<&RenderObjectTable::on_model_change>(this);
+        m_registry.on_update<ModelComponent>().connect<&RenderObjectTable::on_model_change>(this);
+        m_registry.on_destroy<ModelComponent>().connect<&RenderObjectTable::on_model_destroy>(this);
+        m_registry.on_destroy<WorldTransformComponent>().connect<&RenderObjectTable::on_world_transform_destroy>(this);
+    }
+
+    RenderObjectTable::~RenderObjectTable()
+    {
+        m_registry.on_construct<ModelComponent>().disconnect(this);
+        m_registry.on_update<ModelComponent>().disconnect(this);
+        m_registry.on_destroy<ModelComponent>().disconnect(this);
+        m_registry.on_destroy<WorldTransformComponent>().disconnect(this);
+    }
+
+    void RenderObjectTable::update()
+    {
+        // NOTE: Models without a world transform yet are added once the hierarchy reports them as changed
+        for (const entt::entity entity : m_transform_hierarchy.changed_entities())
+        {
+            if (m_records.contains(entity))
+            {
+                m_moved_entities.push_back(entity);
+            }
+            else if (m_registry.all_of<ModelComponent>(entity))
+            {
+                m_changed_entities.push_back(entity);
+            }
+        }
+    }
+
+    void RenderObjectTable::sync(const std::span<const RefPtr<LoadedGltf>> models, const std::span<MaterialInstance> material_variants)
+    {
+        HE_ASSERT(!models.empty());
+
+        m_moved_opaque_surfaces.clear();
+
+        for (const entt::entity entity : m_changed_entities)
+        {
+            if (!m_registry.valid(entity) || !m_registry.all_of<ModelComponent, WorldTransformComponent>(entity))
+            {
+                continue;
+            }
+
+            // FIXME: Use the model of the component, once models are assets
+            const ModelComponent &model = m_registry.get<ModelComponent>(entity);
+
+            Record record = {};
+            models[model.model_index % models.size()]->draw(glm::mat4(1.0f), record.local_surfaces);
+
+            // NOTE: Only opaque surfaces are replaced, as the variants are opaque materials
+            if (model.material_index != 0 && !material_variants.empty())
+            {
+                MaterialInstance *material = &material_variants[(model.material_index - 1) % material_variants.size()];
+                for (RenderObject &render_object : record.local_surfaces.opaque_surfaces)
+                {
+                    render_object.material = material;
+                }
+            }
+
+            // NOTE: Publishes the model bounds, so the spatial index can answer queries for the entity
+            BoundsComponent bounds = {};
+            for (const RenderObject &render_object : record.local_surfaces.opaque_surfaces)
+            {
+                bounds.box.merge(render_object.bounds);
+            }
+            for (const RenderObject &render_object : record.local_surfaces.transparent_surfaces)
+            {
+                bounds.box.merge(render_object.bounds);
+            }
+            m_registry.emplace_or_replace<BoundsComponent>(entity, bounds);
+
+            m_records.insert_or_assign(entity, std::move(record));
+            m_layout_dirty = true;
+        }
+        m_changed_entities.clear();
+
+        if (m_layout_dirty)
+        {
+            rebuild_draw_context();
+            m_moved_entities.clear();
+            return;
+        }
+
+        for (const entt::entity entity : m_moved_entities)
+        {
+            const auto record = m_records.find(entity);
+            if (record != m_records.end())
+            {
+                update_transforms(entity, record->second);
+
+                m_moved_opaque_surfaces.push_back({
+                    .offset = record->second.opaque_offset,
+                    .count = static_cast<uint32_t>(record->second.local_surfaces.opaque_surfaces.size()),
+                });
+            }
+        }
+        m_moved_entities.clear();
+    }
+
+    const DrawContext &RenderObjectTable::draw_context() const
+    {
+        return m_draw_context;
+    }
+
+    uint64_t RenderObjectTable::layout_version() const
+    {
+        return m_layout_version;
+    }
+
+    const std::vector<RenderObjectTable::SurfaceRange> &RenderObjectTable::moved_opaque_surfaces() const
+    {
+        return m_moved_opaque_surfaces;
+    }
+
+    void RenderObjectTable::on_model_change(entt::registry &registry, const entt::entity entity)
+    {
+        HE_UNUSED(registry);
+
+        m_changed_entities.push_back(entity);
+    }
+
+    void RenderObjectTable::on_model_destroy(entt::registry &registry, const entt::entity entity)
+    {
+        HE_UNUSED(registry);
+
+        if (m_records.erase(entity) > 0)
+        {
+            m_layout_dirty = true;
+        }
+    }
+
+    // NOTE: The record is added again, once the entity gets a transform and the hierarchy reports it as changed
+    void RenderObjectTable::on_world_transform_destroy(entt::registry &registry, const entt::entity entity)
+    {
+        HE_UNUSED(registry);
+
+        if (m_records.erase(entity) > 0)
+        {
+            m_layout_dirty = true;
+        }
+    }
+
+    void RenderObjectTable::rebuild_draw_context()
+    {
+        m_draw_context.opaque_surfaces.clear();
+        m_draw_context.transparent_surfaces.clear();
+
+        for (auto &[entity, record] : m_records)
+        {
+            record.opaque_offset = static_cast<uint32_t>(m_draw_context.opaque_surfaces.size());
+            record.transparent_offset = static_cast<uint32_t>(m_draw_context.transparent_surfaces.size());
+
+            m_draw_context.opaque_surfaces.insert(
+                m_draw_context.opaque_surfaces.end(),
+                record.local_surfaces.opaque_surfaces.begin(),
+                record.local_surfaces.opaque_surfaces.end());
+            m_draw_context.transparent_surfaces.insert(
+                m_draw_context.transparent_surfaces.end(),
+                record.local_surfaces.transparent_surfaces.begin(),
+                record.local_surfaces.transparent_surfaces.end());
+
+            update_transforms(entity, record);
+        }
+
+        m_layout_dirty = false;
+        m_layout_version += 1;
+    }
+
+    void RenderObjectTable::update_transforms(const entt::entity entity, const Record &record)
+    {
+        const WorldTransformComponent *world_transform = m_registry.try_get<WorldTransformComponent>(entity);
+        if (world_transform == nullptr)
+        {
+            return;
+        }
+
+        const glm::mat4 world_matrix = m_transform_hierarchy.world_matrix(world_transform->index);
+
+        for (size_t index = 0; index < record.local_surfaces.opaque_surfaces.size(); ++index)
+        {
+            RenderObject &render_object = m_draw_context.opaque_surfaces[record.opaque_offset + index];
+            render_object.transform = world_matrix * record.local_surfaces.opaque_surfaces[index].transform;
+            render_object.bounds = record.local_surfaces.opaque_surfaces[index].bounds.transformed(world_matrix);
+        }
+
+        for (size_t index = 0; index < record.local_surfaces.transparent_surfaces.size(); ++index)
+        {
+            RenderObject &render_object = m_draw_context.transparent_surfaces[record.transparent_offset + index];
+            render_object.transform = world_matrix * record.local_surfaces.transparent_surfaces[index].transform;
+            render_object.bounds = record.local_surfaces.transparent_surfaces[index].bounds.transformed(world_matrix);
+        }
+    }
+} // namespace hyper_engine
\ No newline at end of file
@@ -22,13 +22,11 @@ namespace hyper_engine
 {
     GridPass::GridPass(
         const ShaderCompiler &shader_compiler,
-        const RefPtr<Texture> &render_texture,
+        const Format render_format,
         const RefPtr<TextureView> &render_texture_view,
-        const RefPtr<Texture> &depth_texture,
+        const Format depth_format,
         const RefPtr<TextureView> &depth_texture_view)
-        : m_render_texture(render_texture)
-        , m_render_texture_view(render_texture_view)
-        , m_depth_texture(depth_texture)
+        : m_render_texture_view(render_texture_view)
         , m_depth_texture_view(depth_texture_view)
         , m_pipeline_layout(
               GraphicsDevice::get()->create_pipeline_layout({
@@ -70,7 +68,7 @@ namespace hyper_engine
                   .color_attachment_states =
                       {
                           {
-                              .format = m_render_texture->format(),
+                              .format = render_format,
                               .blend_state =
                                   {
                                       .blend_enable = true,
@@ -95,7 +93,7 @@ namespace hyper_engine
                       {
                           .depth_test_enable = true,
                           .depth_write_enable = true,
-                          .depth_format = m_depth_texture->format(),
+                          .depth_format = depth_format,
                           .depth_compare_operation = CompareOperation::Less,
                           .depth_bias_state = {},
                       },
@@ -127,12 +125,14 @@ namespace hyper_engine
             .depth_stencil_attachment =
                 {
                     .view = m_depth_texture_view,
+                    // NOTE: The grid is the last pass using the depth, so it doesn't have to be written back
                     .depth_operation =
                         {
                             .load_operation = LoadOperation::Load,
-                            .store_operation = StoreOperation::Store,
+                            .store_operation = StoreOperation::DontCare,
                         },
                 },
+            .secondary_count = 0,
         });
 
         render_pass->set_pipeline(m_pipeline);
@@ -0,0 +1,402 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_render/render_passes/indirect_pass.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <map>
+#include <string>
+#include <utility>
+
+#include <hyper_core/assertion.hpp>
+#include <hyper_core/filesystem.hpp>
+#include <hyper_core/metrics.hpp>
+#include <hyper_rhi/buffer.hpp>
+#include <hyper_rhi/command_list.hpp>
+#include <hyper_rhi/compute_pass.hpp>
+#include <hyper_rhi/compute_pipeline.hpp>
+#include <hyper_rhi/graphics_device.hpp>
+#include <hyper_rhi/pipeline_layout.hpp>
+#include <hyper_rhi/render_pass.hpp>
+#include <hyper_rhi/render_pipeline.hpp>
+#include <hyper_rhi/shader_compiler.hpp>
+#include <hyper_rhi/shader_module.hpp>
+#include <hyper_rhi/texture_view.hpp>
+
+#include "hyper_render/geometry_arena.hpp"
+#include "hyper_render/render_object_table.hpp"
+#include "hyper_render/renderable.hpp"
+
+#include "shader_interop.h"
+
+namespace hyper_engine
+{
+    static_assert(sizeof(ShaderDrawCommand) == 5 * sizeof(uint32_t));
+    static_assert(sizeof(ShaderCluster) == 16 * sizeof(uint32_t));
+
+    // NOTE: Buffers only grow, so a scene settling at a size doesn't recreate them every layout change
+    static void reserve_buffer(RefPtr<Buffer> &buffer, const std::string &label, const uint64_t byte_size, const BitFlags<BufferUsage> usage)
+    {
+        const uint64_t required_size = std::max<uint64_t>(byte_size, sizeof(uint32_t));
+        if (buffer && buffer->byte_size() >= required_size)
+        {
+            return;
+        }
+
+        // NOTE: The previous frame finished before recording starts, so the old buffer can be released right away
+        buffer = GraphicsDevice::get()->create_buffer({
+            .label = label,
+            .byte_size = std::bit_ceil(required_size),
+            .usage = usage,
+        });
+    }
+
+    static ShaderObject to_shader_object(const RenderObject &render_object, const uint32_t bucket)
+    {
+        return {
+            .transform_matrix = render_object.transform,
+            .bounds_center = glm::vec4(render_object.bounds.center(), 0.0f),
+            .bounds_extents = glm::vec4(render_object.bounds.extents(), 0.0f),
+            .mesh_id = render_object.mesh_id,
+            .material = render_object.material->buffer->handle(),
+            .first_index = render_object.first_index,
+            .index_count = render_object.index_count,
+            .bucket = bucket,
+            .padding_0 = 0,
+            .padding_1 = 0,
+            .padding_2 = 0,
+        };
+    }
+
+    static ShaderCluster to_shader_cluster(const GltfMeshlet &meshlet, const uint32_t object_index)
+    {
+        return {
+            .bounding_sphere = glm::vec4(meshlet.bounding_sphere.center, meshlet.bounding_sphere.radius),
+            .cone_apex = glm::vec4(meshlet.cone_apex, 0.0f),
+            .cone_axis = glm::vec4(meshlet.cone_axis, meshlet.cone_cutoff),
+            .object_index = object_index,
+            .first_index = meshlet.first_index,
+            .index_count = meshlet.index_count,
+            .padding_0 = 0,
+        };
+    }
+
+    IndirectPass::IndirectPass(
+        const ShaderCompiler &shader_compiler,
+        const RefPtr<TextureView> &render_texture_view,
+        const RefPtr<TextureView> &depth_texture_view,
+        const RefPtr<Buffer> &scene_buffer,
+        const RefPtr<GeometryArena> &geometry_arena)
+        : m_render_texture_view(render_texture_view)
+        , m_depth_texture_view(depth_texture_view)
+        , m_scene_buffer(scene_buffer)
+        , m_geometry_arena(geometry_arena)
+        , m_cull_pipeline_layout(
+              GraphicsDevice::get()->create_pipeline_layout({
+                  .label = "Culling",
+                  .push_constant_size = sizeof(CullPushConstants),
+              }))
+        , m_cull_shader(
+              GraphicsDevice::get()->create_shader_module({
+                  .label = "Culling",
+                  .type = ShaderType::Compute,
+                  .entry_name = "cs_main",
+                  .bytes = shader_compiler
+                               .compile({
+                                   .type = ShaderType::Compute,
+                                   .entry_name = "cs_main",
+                                   .data = filesystem::read_file("./assets/shaders/cull_shader.hlsl"),
+                               })
+                               .spirv,
+              }))
+        , m_cull_pipeline(
+              GraphicsDevice::get()->create_compute_pipeline({
+                  .label = "Culling",
+                  .layout = m_cull_pipeline_layout,
+                  .shader = m_cull_shader,
+              }))
+        , m_frustum_buffer(
+              GraphicsDevice::get()->create_buffer({
+                  .label = "Culling Frustum",
+                  .byte_size = sizeof(ShaderFrustum),
+                  .usage = {BufferUsage::Storage, BufferUsage::ShaderResource},
+              }))
+    {
+    }
+
+    IndirectPass::~IndirectPass() = default;
+
+    void IndirectPass::render(const RefPtr<CommandList> &command_list, const RenderObjectTable &render_objects, const Frustum &frustum)
+    {
+        if (render_objects.layout_version() != m_layout_version)
+        {
+            rebuild_objects(command_list, render_objects.draw_context().opaque_surfaces);
+            m_layout_version = render_objects.layout_version();
+        }
+        else
+        {
+            update_objects(command_list, render_objects);
+        }
+
+        cull(command_list, frustum);
+        draw(command_list);
+    }
+
+    void IndirectPass::rebuild_objects(const RefPtr<CommandList> &command_list, const std::span<const RenderObject> render_objects)
+    {
+        m_buckets.clear();
+        m_objects.clear();
+        m_objects.reserve(render_objects.size());
+        m_clusters.clear();
+
+        std::map<std::pair<const RenderPipeline *, const Buffer *>, uint32_t> bucket_indices;
+        for (const RenderObject &render_object : render_objects)
+        {
+            HE_ASSERT(render_object.material->indirect_pipeline != nullptr);
+
+            const auto [bucket_index, inserted] = bucket_indices.try_emplace(
+                {render_object.material->indirect_pipeline.get(), render_object.index_buffer.get()},
+                static_cast<uint32_t>(m_buckets.size()));
+            if (inserted)
+            {
+                m_buckets.push_back({
+                    .pipeline = render_object.material->indirect_pipeline,
+                    .index_buffer = render_object.index_buffer,
+                    .index_format = render_object.index_format,
+                    .command_offset = 0,
+                    .command_capacity = 0,
+                });
+            }
+
+            // NOTE: The clusters only reference their object, so moving objects never touches the cluster buffer
+            const auto object_index = static_cast<uint32_t>(m_objects.size());
+            for (const GltfMeshlet &meshlet : render_object.meshlets)
+            {
+                m_clusters.push_back(to_shader_cluster(meshlet, object_index));
+            }
+
+            m_buckets[bucket_index->second].command_capacity += static_cast<uint32_t>(render_object.meshlets.size());
+            m_objects.push_back(to_shader_object(render_object, bucket_index->second));
+        }
+
+        // NOTE: Every bucket owns a range of the command buffer large enough for all of its clusters to be visible
+        std::vector<uint32_t> bucket_offsets;
+        bucket_offsets.reserve(m_buckets.size());
+
+        uint32_t command_offset = 0;
+        for (DrawBucket &bucket : m_buckets)
+        {
+            bucket.command_offset = command_offset;
+            bucket_offsets.push_back(command_offset);
+            command_offset += bucket.command_capacity;
+        }
+
+        reserve_buffer(
+            m_object_buffer,
+            "Indirect Objects",
+            m_objects.size() * sizeof(ShaderObject),
+            {BufferUsage::Storage, BufferUsage::ShaderResource});
+        reserve_buffer(
+            m_cluster_buffer,
+            "Indirect Clusters",
+            m_clusters.size() * sizeof(ShaderCluster),
+            {BufferUsage::Storage, BufferUsage::ShaderResource});
+        reserve_buffer(
+            m_bucket_offset_buffer,
+            "Indirect Bucket Offsets",
+            bucket_offsets.size() * sizeof(uint32_t),
+            {BufferUsage::Storage, BufferUsage::ShaderResource});
+        reserve_buffer(
+            m_draw_count_buffer,
+            "Indirect Draw Counts",
+            m_buckets.size() * sizeof(uint32_t),
+            {BufferUsage::Indirect, BufferUsage::Storage, BufferUsage::ShaderResource});
+        reserve_buffer(
+            m_draw_command_buffer,
+            "Indirect Draw Commands",
+            m_clusters.size() * sizeof(ShaderDrawCommand),
+            {BufferUsage::Indirect, BufferUsage::Storage, BufferUsage::ShaderResource});
+        reserve_buffer(
+            m_visible_object_buffer,
+            "Indirect Visible Objects",
+            m_clusters.size() * sizeof(uint32_t),
+            {BufferUsage::Storage, BufferUsage::ShaderResource});
+
+        if (!m_objects.empty())
+        {
+            command_list->write_buffer(m_object_buffer, m_objects.data(), m_objects.size() * sizeof(ShaderObject), 0);
+            command_list->write_buffer(m_bucket_offset_buffer, bucket_offsets.data(), bucket_offsets.size() * sizeof(uint32_t), 0);
+        }
+
+        if (!m_clusters.empty())
+        {
+            command_list->write_buffer(m_cluster_buffer, m_clusters.data(), m_clusters.size() * sizeof(ShaderCluster), 0);
+        }
+
+        static Gauge &cluster_gauge = MetricsRegistry::get()->gauge("render.indirect.clusters");
+        cluster_gauge.set(static_cast<int64_t>(m_clusters.size()));
+    }
+
+    void IndirectPass::update_objects(const RefPtr<CommandList> &command_list, const RenderObjectTable &render_objects)
+    {
+        const std::span<const RenderObject> surfaces = render_objects.draw_context().opaque_surfaces;
+        for (const RenderObjectTable::SurfaceRange &range : render_objects.moved_opaque_surfaces())
+        {
+            if (range.count == 0)
+            {
+                continue;
+            }
+
+            for (uint32_t index = range.offset; index < range.offset + range.count; ++index)
+            {
+                m_objects[index] = to_shader_object(surfaces[index], m_objects[index].bucket);
+            }
+
+            command_list->write_buffer(
+                m_object_buffer,
+                &m_objects[range.offset],
+                range.count * sizeof(ShaderObject),
+                range.offset * sizeof(ShaderObject));
+        }
+    }
+
+    void IndirectPass::cull(const RefPtr<CommandList> &command_list, const Frustum &frustum)
+    {
+        if (m_clusters.empty())
+        {
+            return;
+        }
+
+        ShaderFrustum shader_frustum = {};
+        std::ranges::copy(frustum.planes, shader_frustum.planes);
+
+        command_list->write_buffer(m_frustum_buffer, &shader_frustum, sizeof(ShaderFrustum), 0);
+        command_list->clear_buffer(m_draw_count_buffer, m_buckets.size() * sizeof(uint32_t), 0);
+
+        command_list->insert_barriers({
+            .memory_barriers =
+                {
+                    {
+                        .stage_before = BarrierPipelineStage::AllTransfer,
+                        .stage_after = {BarrierPipelineStage::ComputeShader, BarrierPipelineStage::VertexShader, BarrierPipelineStage::FragmentShader},
+                        .access_before = BarrierAccess::TransferWrite,
+                        .access_after = {BarrierAccess::ShaderRead, BarrierAccess::ShaderWrite},
+                    },
+                },
+            .buffer_memory_barriers = {},
+            .texture_memory_barriers = {},
+        });
+
+        {
+            const RefPtr<ComputePass> compute_pass = command_list->begin_compute_pass({
+                .label = "Culling",
+                .label_color =
+                    {
+                        .red = 255,
+                        .green = 170,
+                        .blue = 0,
+                    },
+            });
+
+            const CullPushConstants cull_push_constants = {
+                .frustum = m_frustum_buffer->handle(),
+                .objects = m_object_buffer->handle(),
+                .clusters = m_cluster_buffer->handle(),
+                .bucket_offsets = m_bucket_offset_buffer->handle(),
+                .draw_counts = m_draw_count_buffer->handle(),
+                .draw_commands = m_draw_command_buffer->handle(),
+                .visible_objects = m_visible_object_buffer->handle(),
+                .cluster_count = static_cast<uint32_t>(m_clusters.size()),
+            };
+
+            compute_pass->set_pipeline(m_cull_pipeline);
+            compute_pass->set_push_constants(&cull_push_constants, sizeof(CullPushConstants));
+            compute_pass->dispatch((static_cast<uint32_t>(m_clusters.size()) + s_group_size - 1) / s_group_size, 1, 1);
+        }
+
+        command_list->insert_barriers({
+            .memory_barriers =
+                {
+                    {
+                        .stage_before = BarrierPipelineStage::ComputeShader,
+                        .stage_after = {BarrierPipelineStage::DrawIndirect, BarrierPipelineStage::VertexShader, BarrierPipelineStage::FragmentShader},
+                        .access_before = BarrierAccess::ShaderWrite,
+                        .access_after = {BarrierAccess::IndirectCommandRead, BarrierAccess::ShaderRead},
+                    },
+                },
+            .buffer_memory_barriers = {},
+            .texture_memory_barriers = {},
+        });
+    }
+
+    void IndirectPass::draw(const RefPtr<CommandList> &command_list) const
+    {
+        const RefPtr<RenderPass> render_pass = command_list->begin_render_pass({
+            .label = "Indirect Opaque",
+            .label_color =
+                {
+                    .red = 254,
+                    .green = 17,
+                    .blue = 85,
+                },
+            .color_attachments =
+                {
+                    {
+                        .view = m_render_texture_view,
+                        .operation =
+                            {
+                                .load_operation = LoadOperation::Clear,
+                                .store_operation = StoreOperation::Store,
+                            },
+                    },
+                },
+            .depth_stencil_attachment =
+                {
+                    .view = m_depth_texture_view,
+                    .depth_operation =
+                        {
+                            .load_operation = LoadOperation::Clear,
+                            .store_operation = StoreOperation::Store,
+                        },
+                },
+            .secondary_count = 0,
+        });
+
+        if (m_clusters.empty())
+        {
+            return;
+        }
+
+        static Counter &multi_draw_counter = MetricsRegistry::get()->counter("render.indirect.multi_draws");
+
+        const IndirectPushConstants indirect_push_constants = {
+            .scene = m_scene_buffer->handle(),
+            .meshes = m_geometry_arena->mesh_buffer()->handle(),
+            .objects = m_object_buffer->handle(),
+            .visible_objects = m_visible_object_buffer->handle(),
+        };
+
+        for (size_t bucket_index = 0; bucket_index < m_buckets.size(); ++bucket_index)
+        {
+            const DrawBucket &bucket = m_buckets[bucket_index];
+
+            render_pass->set_pipeline(bucket.pipeline);
+            render_pass->set_index_buffer(bucket.index_buffer, bucket.index_format);
+            render_pass->set_push_constants(&indirect_push_constants, sizeof(IndirectPushConstants));
+
+            render_pass->draw_indexed_indirect_count(
+                m_draw_command_buffer,
+                bucket.command_offset * sizeof(ShaderDrawCommand),
+                m_draw_count_buffer,
+                bucket_index * sizeof(uint32_t),
+                bucket.command_capacity,
+                sizeof(ShaderDrawCommand));
+        }
+
+        multi_draw_counter.add(m_buckets.size());
+    }
+} // namespace hyper_engine
\ No newline at end of file
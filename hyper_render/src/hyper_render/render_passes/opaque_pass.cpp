@@ -6,30 +6,94 @@
 
 #include "hyper_render/render_passes/opaque_pass.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <tuple>
+
 #include <hyper_core/filesystem.hpp>
+#include <hyper_core/job_system.hpp>
+#include <hyper_core/metrics.hpp>
 #include <hyper_rhi/buffer.hpp>
 #include <hyper_rhi/command_list.hpp>
+#include <hyper_rhi/graphics_device.hpp>
 #include <hyper_rhi/render_pass.hpp>
 #include <hyper_rhi/texture_view.hpp>
 
+#include "hyper_render/geometry_arena.hpp"
 #include "hyper_render/renderer.hpp"
 
 #include "shader_interop.h"
 
 namespace hyper_engine
 {
+    static_assert(sizeof(ShaderInstance) == sizeof(glm::mat4));
+
+    // NOTE: Opaque keys are ordered by state first and front to back last, transparent keys back to front first
+    //       opaque:      pass (1) | pipeline (10) | material (14) | surface (23) | depth (16)
+    //       transparent: pass (1) | inverted depth (16) | pipeline (10) | material (14) | surface (23)
+    static constexpr uint32_t g_pipeline_bits = 10;
+    static constexpr uint32_t g_material_bits = 14;
+    static constexpr uint32_t g_surface_bits = 23;
+    static constexpr uint32_t g_depth_bits = 16;
+
+    static_assert(1 + g_pipeline_bits + g_material_bits + g_surface_bits + g_depth_bits == 64);
+
+    static uint32_t compact_id(std::unordered_map<const void *, uint32_t> &ids, const void *pointer, const uint32_t bits)
+    {
+        const uint32_t id = ids.try_emplace(pointer, static_cast<uint32_t>(ids.size())).first->second;
+
+        // NOTE: Ids past the field width wrap around, which only costs batching opportunities and never correctness
+        return id & ((1u << bits) - 1);
+    }
+
+    // NOTE: Positive floats keep their order when compared as integers, so the upper bits are a cheap monotonic quantization
+    static uint64_t quantize_depth(const float distance)
+    {
+        uint32_t bits = 0;
+        std::memcpy(&bits, &distance, sizeof(float));
+        return bits >> (32 - g_depth_bits);
+    }
+
     OpaquePass::OpaquePass(
         const RefPtr<TextureView> &render_texture_view,
         const RefPtr<TextureView> &depth_texture_view,
-        const RefPtr<Buffer> &scene_buffer)
+        const RefPtr<Buffer> &scene_buffer,
+        const RefPtr<GeometryArena> &geometry_arena)
         : m_render_texture_view(render_texture_view)
         , m_depth_texture_view(depth_texture_view)
         , m_scene_buffer(scene_buffer)
+        , m_geometry_arena(geometry_arena)
     {
     }
 
-    void OpaquePass::render(const RefPtr<CommandList> &command_list, const DrawContext &draw_context) const
+    void OpaquePass::render(
+        const RefPtr<CommandList> &command_list,
+        const DrawContext &draw_context,
+        const glm::vec3 &camera_position,
+        const LoadOperation load_operation)
     {
+        m_camera_position = camera_position;
+
+        m_pipeline_ids.clear();
+        m_material_ids.clear();
+        m_mesh_ids.clear();
+        m_surface_ids.clear();
+
+        // NOTE: Opaque batches come first, the transparent surfaces are appended behind them into the same instance buffer
+        m_batches.clear();
+        m_instances.clear();
+
+        build_batches(draw_context.opaque_surfaces, false);
+        build_batches(draw_context.transparent_surfaces, true);
+
+        upload_instances(command_list);
+
+        // NOTE: The calling thread only waits for the workers, so there is at most one secondary per worker
+        const uint32_t worker_count = JobSystem::get()->thread_count() - 1;
+        const uint32_t parallel_count = std::min(worker_count, static_cast<uint32_t>(m_batches.size() / s_secondary_batch_count));
+        const uint32_t secondary_count = parallel_count > 1 ? parallel_count : 0;
+
         const RefPtr<RenderPass> render_pass = command_list->begin_render_pass({
             .label = "Opaque",
             .label_color =
@@ -44,7 +108,7 @@ namespace hyper_engine
                         .view = m_render_texture_view,
                         .operation =
                             {
-                                .load_operation = LoadOperation::Clear,
+                                .load_operation = load_operation,
                                 .store_operation = StoreOperation::Store,
                             },
                     },
@@ -54,46 +118,184 @@ namespace hyper_engine
                     .view = m_depth_texture_view,
                     .depth_operation =
                         {
-                            .load_operation = LoadOperation::Clear,
+                            .load_operation = load_operation,
                             .store_operation = StoreOperation::Store,
                         },
                 },
+            .secondary_count = secondary_count,
         });
 
-        for (const RenderObject &render_object : draw_context.opaque_surfaces)
+        if (secondary_count == 0)
         {
-            render_pass->set_pipeline(render_object.material->pipeline);
+            record_batches(*render_pass, m_batches);
+            return;
+        }
 
-            render_pass->set_index_buffer(render_object.index_buffer);
+        // NOTE: Every secondary records a contiguous range of the sorted batches, so the draw order doesn't depend on the threads
+        const size_t batches_per_secondary = (m_batches.size() + secondary_count - 1) / secondary_count;
+        JobContext context;
+        JobSystem::get()->dispatch(
+            context,
+            secondary_count,
+            1,
+            [this, &render_pass, batches_per_secondary](const DispatchArgs args)
+            {
+                const size_t first_batch = args.job_index * batches_per_secondary;
+                if (first_batch >= m_batches.size())
+                {
+                    return;
+                }
 
-            const ObjectPushConstants mesh_push_constants = {
-                .scene = m_scene_buffer->handle(),
-                .mesh = render_object.mesh_buffer->handle(),
-                .material = render_object.material->buffer->handle(),
-                .padding_0 = 0,
-                .transform_matrix = render_object.transform,
+                const size_t batch_count = std::min(batches_per_secondary, m_batches.size() - first_batch);
+
+                const RefPtr<RenderPass> secondary = render_pass->begin_secondary(args.job_index);
+                record_batches(*secondary, std::span<const DrawBatch>(m_batches).subspan(first_batch, batch_count));
+            });
+
+        // NOTE: Only waits for the recordings, jobs of other systems may still be running
+        JobSystem::get()->wait(context);
+    }
+
+    void OpaquePass::build_batches(const std::span<const RenderObject> render_objects, const bool transparent)
+    {
+        const auto batch_key = [](const RenderObject &render_object)
+        {
+            return std::make_tuple(
+                render_object.material,
+                render_object.mesh_id,
+                render_object.index_buffer.get(),
+                render_object.first_index,
+                render_object.index_count);
+        };
+
+        m_sort_entries.resize(render_objects.size());
+        m_sort_scratch.resize(render_objects.size());
+        for (uint32_t index = 0; index < render_objects.size(); ++index)
+        {
+            m_sort_entries[index] = {
+                .key = sort_key(render_objects[index], transparent),
+                .value = index,
             };
-            render_pass->set_push_constants(&mesh_push_constants, sizeof(ObjectPushConstants));
+        }
+
+        radix_sort(m_sort_entries, m_sort_scratch);
 
-            render_pass->draw_indexed(render_object.index_count, 1, render_object.first_index, 0, 0);
+        // NOTE: Equal keys don't guarantee equal state once ids wrap around, so the batches still compare the full state
+        for (const SortEntry &entry : m_sort_entries)
+        {
+            const RenderObject &render_object = render_objects[entry.value];
+
+            const bool same_batch = !m_batches.empty() && batch_key(*m_batches.back().render_object) == batch_key(render_object);
+            if (!same_batch)
+            {
+                m_batches.push_back({
+                    .render_object = &render_object,
+                    .first_instance = static_cast<uint32_t>(m_instances.size()),
+                    .instance_count = 0,
+                });
+            }
+
+            m_batches.back().instance_count += 1;
+            m_instances.push_back(render_object.transform);
         }
+    }
 
-        for (const RenderObject &render_object : draw_context.transparent_surfaces)
+    uint64_t OpaquePass::sort_key(const RenderObject &render_object, const bool transparent)
+    {
+        const uint64_t pipeline = compact_id(m_pipeline_ids, render_object.material->pipeline.get(), g_pipeline_bits);
+        const uint64_t material = compact_id(m_material_ids, render_object.material, g_material_bits);
+
+        // NOTE: Surfaces are identified by their index buffer and first index, as the render objects don't store the surface itself
+        const uint64_t mesh = m_mesh_ids.try_emplace(render_object.index_buffer.get(), static_cast<uint32_t>(m_mesh_ids.size())).first->second;
+        const uint64_t surface_key = (mesh << 32) | render_object.first_index;
+        const uint64_t surface =
+            m_surface_ids.try_emplace(surface_key, static_cast<uint32_t>(m_surface_ids.size())).first->second & ((1u << g_surface_bits) - 1);
+
+        const uint64_t depth = quantize_depth(glm::length(render_object.bounds.center() - m_camera_position));
+
+        if (!transparent)
         {
-            render_pass->set_pipeline(render_object.material->pipeline);
+            return (pipeline << (g_material_bits + g_surface_bits + g_depth_bits)) | (material << (g_surface_bits + g_depth_bits)) |
+                   (surface << g_depth_bits) | depth;
+        }
 
-            render_pass->set_index_buffer(render_object.index_buffer);
+        const uint64_t inverted_depth = ((1u << g_depth_bits) - 1) - depth;
+        return (uint64_t{1} << 63) | (inverted_depth << (g_pipeline_bits + g_material_bits + g_surface_bits)) |
+               (pipeline << (g_material_bits + g_surface_bits)) | (material << g_surface_bits) | surface;
+    }
+
+    void OpaquePass::upload_instances(const RefPtr<CommandList> &command_list)
+    {
+        if (m_instances.empty())
+        {
+            return;
+        }
+
+        const uint64_t byte_size = m_instances.size() * sizeof(ShaderInstance);
+        if (!m_instance_buffer || m_instance_buffer->byte_size() < byte_size)
+        {
+            // NOTE: The previous frame finished before recording starts, so the old buffer can be released right away
+            m_instance_buffer = GraphicsDevice::get()->create_buffer({
+                .label = "Opaque Instances",
+                .byte_size = std::bit_ceil(byte_size),
+                .usage = {BufferUsage::Storage, BufferUsage::ShaderResource},
+            });
+        }
 
+        command_list->write_buffer(m_instance_buffer, m_instances.data(), byte_size, 0);
+
+        command_list->insert_barriers({
+            .memory_barriers = {},
+            .buffer_memory_barriers =
+                {
+                    {
+                        .stage_before = BarrierPipelineStage::AllTransfer,
+                        .stage_after = BarrierPipelineStage::VertexShader,
+                        .access_before = BarrierAccess::TransferWrite,
+                        .access_after = BarrierAccess::ShaderRead,
+                        .buffer = m_instance_buffer,
+                    },
+                },
+            .texture_memory_barriers = {},
+        });
+    }
+
+    void OpaquePass::record_batches(RenderPass &render_pass, const std::span<const DrawBatch> batches) const
+    {
+        static Counter &draw_call_counter = MetricsRegistry::get()->counter("render.opaque.draw_calls");
+        static Counter &triangle_counter = MetricsRegistry::get()->counter("render.opaque.triangles");
+
+        uint64_t draw_calls = 0;
+        uint64_t triangles = 0;
+
+        for (const DrawBatch &batch : batches)
+        {
+            const RenderObject &render_object = *batch.render_object;
+
+            // NOTE: The batches are sorted by pipeline, the render pass skips rebinding the bound one and counts the actual switches
+            render_pass.set_pipeline(render_object.material->pipeline);
+            render_pass.set_index_buffer(render_object.index_buffer, render_object.index_format);
+
+            // NOTE: The first instance is passed through the push constants, as SV_InstanceID doesn't include the base instance on every backend
             const ObjectPushConstants mesh_push_constants = {
                 .scene = m_scene_buffer->handle(),
-                .mesh = render_object.mesh_buffer->handle(),
+                .meshes = m_geometry_arena->mesh_buffer()->handle(),
                 .material = render_object.material->buffer->handle(),
+                .instances = m_instance_buffer->handle(),
+                .first_instance = batch.first_instance,
+                .mesh_id = render_object.mesh_id,
                 .padding_0 = 0,
-                .transform_matrix = render_object.transform,
+                .padding_1 = 0,
             };
-            render_pass->set_push_constants(&mesh_push_constants, sizeof(ObjectPushConstants));
+            render_pass.set_push_constants(&mesh_push_constants, sizeof(ObjectPushConstants));
 
-            render_pass->draw_indexed(render_object.index_count, 1, render_object.first_index, 0, 0);
+            render_pass.draw_indexed(render_object.index_count, batch.instance_count, render_object.first_index, 0, 0);
+
+            draw_calls += 1;
+            triangles += static_cast<uint64_t>(render_object.index_count / 3) * batch.instance_count;
         }
+
+        draw_call_counter.add(draw_calls);
+        triangle_counter.add(triangles);
     }
 } // namespace hyper_engine
\ No newline at end of file
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_render/render_passes/present_pass.hpp"
+
+#include <hyper_core/filesystem.hpp>
+#include <hyper_rhi/command_list.hpp>
+#include <hyper_rhi/graphics_device.hpp>
+#include <hyper_rhi/pipeline_layout.hpp>
+#include <hyper_rhi/render_pass.hpp>
+#include <hyper_rhi/render_pipeline.hpp>
+#include <hyper_rhi/shader_compiler.hpp>
+#include <hyper_rhi/shader_module.hpp>
+#include <hyper_rhi/texture_view.hpp>
+
+#include "shader_interop.h"
+
+namespace hyper_engine
+{
+    PresentPass::PresentPass(
+        const ShaderCompiler &shader_compiler,
+        const RefPtr<TextureView> &render_texture_view,
+        const Format output_format,
+        const RefPtr<TextureView> &output_texture_view)
+        : m_render_texture_view(render_texture_view)
+        , m_output_texture_view(output_texture_view)
+        , m_pipeline_layout(
+              GraphicsDevice::get()->create_pipeline_layout({
+                  .label = "Present",
+                  .push_constant_size = sizeof(PresentPushConstants),
+              }))
+        , m_vertex_shader(
+              GraphicsDevice::get()->create_shader_module({
+                  .label = "Present",
+                  .type = ShaderType::Vertex,
+                  .entry_name = "vs_main",
+                  .bytes = shader_compiler
+                               .compile({
+                                   .type = ShaderType::Vertex,
+                                   .entry_name = "vs_main",
+                                   .data = filesystem::read_file("./assets/shaders/present_shader.hlsl"),
+                               })
+                               .spirv,
+              }))
+        , m_fragment_shader(
+              GraphicsDevice::get()->create_shader_module({
+                  .label = "Present",
+                  .type = ShaderType::Fragment,
+                  .entry_name = "fs_main",
+                  .bytes = shader_compiler
+                               .compile({
+                                   .type = ShaderType::Fragment,
+                                   .entry_name = "fs_main",
+                                   .data = filesystem::read_file("./assets/shaders/present_shader.hlsl"),
+                               })
+                               .spirv,
+              }))
+        , m_pipeline(
+              GraphicsDevice::get()->create_render_pipeline({
+                  .label = "Present",
+                  .layout = m_pipeline_layout,
+                  .vertex_shader = m_vertex_shader,
+                  .fragment_shader = m_fragment_shader,
+                  .color_attachment_states =
+                      {
+                          {
+                              .format = output_format,
+                              .blend_state = {},
+                          },
+                      },
+                  .primitive_state =
+                      {
+                          .topology = PrimitiveTopology::TriangleList,
+                          .front_face = FrontFace::CounterClockwise,
+                          .cull_mode = Face::None,
+                          .polygon_mode = PolygonMode::Fill,
+                      },
+                  .depth_stencil_state = {},
+              }))
+    {
+    }
+
+    void PresentPass::render(const RefPtr<CommandList> &command_list) const
+    {
+        const RefPtr<RenderPass> render_pass = command_list->begin_render_pass({
+            .label = "Present",
+            .label_color =
+                LabelColor{
+                    .red = 255,
+                    .green = 204,
+                    .blue = 102,
+                },
+            .color_attachments =
+                {
+                    {
+                        .view = m_output_texture_view,
+                        // NOTE: Every texel is overwritten by the fullscreen triangle
+                        .operation =
+                            {
+                                .load_operation = LoadOperation::DontCare,
+                                .store_operation = StoreOperation::Store,
+                            },
+                    },
+                },
+            .depth_stencil_attachment = {},
+            .secondary_count = 0,
+        });
+
+        render_pass->set_pipeline(m_pipeline);
+
+        const PresentPushConstants present_push_constants = {
+            .render_texture = m_render_texture_view->handle(),
+        };
+        render_pass->set_push_constants(&present_push_constants, sizeof(PresentPushConstants));
+
+        render_pass->draw(3, 1, 0, 0);
+    }
+} // namespace hyper_engine
\ No newline at end of file
@@ -6,10 +6,17 @@
 
 #include "hyper_render/renderable.hpp"
 
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <limits>
+#include <span>
+
 #include <fastgltf/core.hpp>
 #include <fastgltf/glm_element_traits.hpp>
 #include <fastgltf/tools.hpp>
 #include <glm/gtx/quaternion.hpp>
+#include <meshoptimizer.h>
 #include <stb_image.h>
 
 #include <hyper_core/assertion.hpp>
@@ -22,12 +29,233 @@
 #include <hyper_rhi/texture.hpp>
 #include <hyper_rhi/texture_view.hpp>
 
+#include "hyper_render/geometry_arena.hpp"
 #include "hyper_render/mesh.hpp"
 
 #include "shader_interop.h"
 
 namespace hyper_engine
 {
+    static_assert(sizeof(ShaderMesh) == 8 * sizeof(uint32_t) + 2 * sizeof(glm::vec4));
+
+    // NOTE: The limits recommended by meshoptimizer, the cone weight trades tighter spheres for narrower normal cones
+    static constexpr size_t g_meshlet_max_vertices = 64;
+    static constexpr size_t g_meshlet_max_triangles = 124;
+    static constexpr float g_meshlet_cone_weight = 0.25f;
+
+    // NOTE: The post transform cache size meshoptimizer models, the overdraw pass may make the cache up to five percent worse
+    static constexpr uint32_t g_vertex_cache_size = 16;
+    static constexpr float g_overdraw_threshold = 1.05f;
+
+    static constexpr size_t g_max_uint16_vertex_count = 65536;
+
+    struct VertexCacheStatistics
+    {
+        uint64_t triangle_count = 0;
+        uint64_t transformed_before = 0;
+        uint64_t transformed_after = 0;
+        uint64_t vertex_count_before = 0;
+        uint64_t vertex_count_after = 0;
+    };
+
+    static void remap_vertices(
+        std::vector<glm::vec4> &vertices,
+        const size_t base_vertex,
+        const std::span<const uint32_t> remap,
+        const size_t count)
+    {
+        meshopt_remapVertexBuffer(&vertices[base_vertex], &vertices[base_vertex], remap.size(), sizeof(glm::vec4), remap.data());
+        vertices.resize(base_vertex + count);
+    }
+
+    // NOTE: Welds duplicate vertices and reorders the primitive for the vertex cache, overdraw and vertex fetch. The indices are
+    //       relative to the base vertex, every vertex stream is shrunk to the vertices that are left.
+    static void optimize_primitive(
+        std::vector<uint32_t> &indices,
+        std::vector<glm::vec4> &positions,
+        std::vector<glm::vec4> &normals,
+        std::vector<glm::vec4> &colors,
+        std::vector<glm::vec4> &tex_coords,
+        const size_t base_vertex,
+        VertexCacheStatistics &statistics)
+    {
+        const size_t vertex_count = positions.size() - base_vertex;
+        if (indices.empty() || vertex_count == 0)
+        {
+            return;
+        }
+
+        const meshopt_VertexCacheStatistics statistics_before =
+            meshopt_analyzeVertexCache(indices.data(), indices.size(), vertex_count, g_vertex_cache_size, 0, 0);
+
+        const std::array<meshopt_Stream, 4> streams = {
+            meshopt_Stream{
+                .data = &positions[base_vertex],
+                .size = sizeof(glm::vec4),
+                .stride = sizeof(glm::vec4),
+            },
+            meshopt_Stream{
+                .data = &normals[base_vertex],
+                .size = sizeof(glm::vec4),
+                .stride = sizeof(glm::vec4),
+            },
+            meshopt_Stream{
+                .data = &colors[base_vertex],
+                .size = sizeof(glm::vec4),
+                .stride = sizeof(glm::vec4),
+            },
+            meshopt_Stream{
+                .data = &tex_coords[base_vertex],
+                .size = sizeof(glm::vec4),
+                .stride = sizeof(glm::vec4),
+            },
+        };
+
+        std::vector<uint32_t> remap(vertex_count);
+        const size_t unique_vertex_count =
+            meshopt_generateVertexRemapMulti(remap.data(), indices.data(), indices.size(), vertex_count, streams.data(), streams.size());
+
+        meshopt_remapIndexBuffer(indices.data(), indices.data(), indices.size(), remap.data());
+        for (std::vector<glm::vec4> *vertices : {&positions, &normals, &colors, &tex_coords})
+        {
+            remap_vertices(*vertices, base_vertex, remap, unique_vertex_count);
+        }
+
+        meshopt_optimizeVertexCache(indices.data(), indices.data(), indices.size(), unique_vertex_count);
+        meshopt_optimizeOverdraw(
+            indices.data(),
+            indices.data(),
+            indices.size(),
+            &positions[base_vertex].x,
+            unique_vertex_count,
+            sizeof(glm::vec4),
+            g_overdraw_threshold);
+
+        // NOTE: The vertex streams are separate buffers, so the fetch order is applied to each of them through a remap
+        remap.resize(unique_vertex_count);
+        const size_t fetched_vertex_count = meshopt_optimizeVertexFetchRemap(remap.data(), indices.data(), indices.size(), unique_vertex_count);
+
+        meshopt_remapIndexBuffer(indices.data(), indices.data(), indices.size(), remap.data());
+        for (std::vector<glm::vec4> *vertices : {&positions, &normals, &colors, &tex_coords})
+        {
+            remap_vertices(*vertices, base_vertex, remap, fetched_vertex_count);
+        }
+
+        const meshopt_VertexCacheStatistics statistics_after =
+            meshopt_analyzeVertexCache(indices.data(), indices.size(), fetched_vertex_count, g_vertex_cache_size, 0, 0);
+
+        statistics.triangle_count += indices.size() / 3;
+        statistics.transformed_before += statistics_before.vertices_transformed;
+        statistics.transformed_after += statistics_after.vertices_transformed;
+        statistics.vertex_count_before += vertex_count;
+        statistics.vertex_count_after += fetched_vertex_count;
+    }
+
+    // NOTE: Maps the unit sphere onto an octahedron and unfolds its lower half over the diagonals, so two components are enough
+    static glm::vec2 encode_octahedral(const glm::vec3 &normal)
+    {
+        const float length = glm::abs(normal.x) + glm::abs(normal.y) + glm::abs(normal.z);
+        if (length == 0.0f)
+        {
+            return glm::vec2(0.0f);
+        }
+
+        const glm::vec3 projected = normal / length;
+        if (projected.z >= 0.0f)
+        {
+            return glm::vec2(projected);
+        }
+
+        return {
+            (1.0f - glm::abs(projected.y)) * (projected.x >= 0.0f ? 1.0f : -1.0f),
+            (1.0f - glm::abs(projected.x)) * (projected.y >= 0.0f ? 1.0f : -1.0f),
+        };
+    }
+
+    // NOTE: Reorders the indices of the surface meshlet by meshlet, so every meshlet can be drawn as its own range of the index buffer
+    static std::vector<GltfMeshlet> build_meshlets(
+        const std::span<uint32_t> indices,
+        const std::span<const glm::vec4> positions,
+        const uint32_t first_index,
+        const uint32_t base_vertex)
+    {
+        if (indices.empty() || positions.empty())
+        {
+            return {};
+        }
+
+        std::vector<uint32_t> local_indices(indices.size());
+        std::ranges::transform(
+            indices,
+            local_indices.begin(),
+            [base_vertex](const uint32_t index)
+            {
+                return index - base_vertex;
+            });
+
+        const size_t max_meshlets = meshopt_buildMeshletsBound(local_indices.size(), g_meshlet_max_vertices, g_meshlet_max_triangles);
+        std::vector<meshopt_Meshlet> meshlets(max_meshlets);
+        std::vector<uint32_t> meshlet_vertices(max_meshlets * g_meshlet_max_vertices);
+        std::vector<uint8_t> meshlet_triangles(max_meshlets * g_meshlet_max_triangles * 3);
+
+        const size_t meshlet_count = meshopt_buildMeshlets(
+            meshlets.data(),
+            meshlet_vertices.data(),
+            meshlet_triangles.data(),
+            local_indices.data(),
+            local_indices.size(),
+            &positions[0].x,
+            positions.size(),
+            sizeof(glm::vec4),
+            g_meshlet_max_vertices,
+            g_meshlet_max_triangles,
+            g_meshlet_cone_weight);
+
+        std::vector<GltfMeshlet> surface_meshlets;
+        surface_meshlets.reserve(meshlet_count);
+
+        uint32_t index_offset = 0;
+        for (size_t meshlet_index = 0; meshlet_index < meshlet_count; ++meshlet_index)
+        {
+            const meshopt_Meshlet &meshlet = meshlets[meshlet_index];
+            const uint32_t *vertices = &meshlet_vertices[meshlet.vertex_offset];
+            const uint8_t *triangles = &meshlet_triangles[meshlet.triangle_offset];
+
+            const meshopt_Bounds bounds = meshopt_computeMeshletBounds(
+                vertices,
+                triangles,
+                meshlet.triangle_count,
+                &positions[0].x,
+                positions.size(),
+                sizeof(glm::vec4));
+
+            const uint32_t index_count = meshlet.triangle_count * 3;
+            for (uint32_t index = 0; index < index_count; ++index)
+            {
+                indices[index_offset + index] = vertices[triangles[index]] + base_vertex;
+            }
+
+            surface_meshlets.push_back({
+                .first_index = first_index + index_offset,
+                .index_count = index_count,
+                .bounding_sphere =
+                    {
+                        .center = glm::vec3(bounds.center[0], bounds.center[1], bounds.center[2]),
+                        .radius = bounds.radius,
+                    },
+                .cone_apex = glm::vec3(bounds.cone_apex[0], bounds.cone_apex[1], bounds.cone_apex[2]),
+                .cone_axis = glm::vec3(bounds.cone_axis[0], bounds.cone_axis[1], bounds.cone_axis[2]),
+                .cone_cutoff = bounds.cone_cutoff,
+            });
+
+            index_offset += index_count;
+        }
+
+        HE_ASSERT(index_offset == indices.size());
+
+        return surface_meshlets;
+    }
+
     void Node::refresh_transform(const glm::mat4 &parent_matrix)
     {
         world_transform = parent_matrix * local_transform;
@@ -60,10 +288,13 @@ namespace hyper_engine
             const RenderObject render_object = {
                 .index_count = surface.count,
                 .first_index = surface.start_index,
-                .index_buffer = mesh->indices_buffer(),
+                .index_buffer = mesh->index_buffer(),
+                .index_format = mesh->index_format(),
                 .material = &surface.material->data,
                 .transform = node_matrix,
-                .mesh_buffer = mesh->mesh_buffer(),
+                .bounds = surface.bounds.transformed(node_matrix),
+                .mesh_id = mesh->mesh_id(),
+                .meshlets = surface.meshlets,
             };
 
             if (surface.material->data.pass_type == MaterialPassType::MainColor)
@@ -107,12 +338,14 @@ namespace hyper_engine
 
     RefPtr<LoadedGltf> load_gltf(
         const RefPtr<CommandList> &command_list,
+        const RefPtr<GeometryArena> &geometry_arena,
         const RefPtr<TextureView> &white_texture_view,
         const RefPtr<Texture> &error_texture,
         const RefPtr<TextureView> &error_texture_view,
         const RefPtr<Sampler> &default_sampler_linear,
         const GltfMetallicRoughness &metallic_roughness_material,
-        const std::string &path)
+        const std::string &path,
+        const GltfImportOptions &import_options)
     {
         HE_INFO("Loading GLTF '{}'", path);
 
@@ -361,6 +594,8 @@ namespace hyper_engine
         std::vector<glm::vec4> colors;
         std::vector<glm::vec4> tex_coords;
         std::vector<uint32_t> indices;
+        std::vector<uint32_t> primitive_indices;
+        VertexCacheStatistics statistics = {};
         for (const fastgltf::Mesh &mesh : asset->meshes)
         {
             positions.clear();
@@ -383,12 +618,13 @@ namespace hyper_engine
                 {
                     fastgltf::Accessor &accessor = asset->accessors[primitive.indicesAccessor.value()];
 
+                    primitive_indices.clear();
                     fastgltf::iterateAccessor<uint32_t>(
                         asset.get(),
                         accessor,
                         [&](const uint32_t index)
                         {
-                            indices.push_back(index + initial_vertex);
+                            primitive_indices.push_back(index);
                         });
                 }
 
@@ -409,6 +645,18 @@ namespace hyper_engine
                             colors[initial_vertex + index] = glm::vec4(1.0, 1.0, 1.0, 0.0);
                             tex_coords[initial_vertex + index] = glm::vec4(0.0, 0.0, 0.0, 0.0);
                         });
+
+                    for (size_t index = initial_vertex; index < positions.size(); ++index)
+                    {
+                        surface.bounds.merge(glm::vec3(positions[index]));
+                    }
+
+                    surface.bounding_sphere.center = surface.bounds.center();
+                    for (size_t index = initial_vertex; index < positions.size(); ++index)
+                    {
+                        const float radius = glm::length(glm::vec3(positions[index]) - surface.bounding_sphere.center);
+                        surface.bounding_sphere.radius = std::max(surface.bounding_sphere.radius, radius);
+                    }
                 }
 
                 const fastgltf::Attribute *normals_attribute = primitive.findAttribute("NORMAL");
@@ -447,6 +695,25 @@ namespace hyper_engine
                         });
                 }
 
+                if (import_options.optimize_meshes)
+                {
+                    optimize_primitive(primitive_indices, positions, normals, colors, tex_coords, initial_vertex, statistics);
+                }
+
+                std::ranges::transform(
+                    primitive_indices,
+                    std::back_inserter(indices),
+                    [initial_vertex](const uint32_t index)
+                    {
+                        return index + initial_vertex;
+                    });
+
+                surface.meshlets = build_meshlets(
+                    std::span(indices).subspan(surface.start_index, surface.count),
+                    std::span(positions).subspan(initial_vertex),
+                    surface.start_index,
+                    initial_vertex);
+
                 if (primitive.materialIndex.has_value())
                 {
                     surface.material = materials[primitive.materialIndex.value()];
@@ -456,71 +723,84 @@ namespace hyper_engine
                     surface.material = materials[0];
                 }
 
-                surfaces.push_back(surface);
+                surfaces.push_back(std::move(surface));
             }
 
-            const RefPtr<Buffer> positions_buffer = GraphicsDevice::get()->create_buffer({
-                .label = fmt::format("{} Positions", mesh.name),
-                .byte_size = positions.size() * sizeof(glm::vec4),
-                .usage = {BufferUsage::Storage, BufferUsage::ShaderResource},
-            });
-            command_list->write_buffer(positions_buffer, positions.data(), positions.size() * sizeof(glm::vec4), 0);
+            // NOTE: The positions are quantized within the bounds of the mesh, which the shaders get back through the mesh data
+            BoundingBox mesh_bounds;
+            for (const glm::vec4 &position : positions)
+            {
+                mesh_bounds.merge(glm::vec3(position));
+            }
 
-            const RefPtr<Buffer> normals_buffer = GraphicsDevice::get()->create_buffer({
-                .label = fmt::format("{} Normals", mesh.name),
-                .byte_size = normals.size() * sizeof(glm::vec4),
-                .usage = {BufferUsage::Storage, BufferUsage::ShaderResource},
-            });
-            command_list->write_buffer(normals_buffer, normals.data(), normals.size() * sizeof(glm::vec4), 0);
+            const glm::vec3 position_offset = mesh_bounds.is_valid() ? mesh_bounds.min : glm::vec3(0.0f);
+            const glm::vec3 position_scale = mesh_bounds.is_valid() ? mesh_bounds.max - mesh_bounds.min : glm::vec3(0.0f);
+            const glm::vec3 inverse_scale = glm::vec3(1.0f) / glm::max(position_scale, glm::vec3(std::numeric_limits<float>::min()));
 
-            const RefPtr<Buffer> colors_buffer = GraphicsDevice::get()->create_buffer({
-                .label = fmt::format("{} Colors", mesh.name),
-                .byte_size = colors.size() * sizeof(glm::vec4),
-                .usage = {BufferUsage::Storage, BufferUsage::ShaderResource},
-            });
-            command_list->write_buffer(colors_buffer, colors.data(), colors.size() * sizeof(glm::vec4), 0);
+            std::vector<glm::uvec2> packed_positions(positions.size());
+            std::vector<uint32_t> packed_normals(normals.size());
+            std::vector<uint32_t> packed_colors(colors.size());
+            std::vector<uint32_t> packed_tex_coords(tex_coords.size());
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                const glm::vec3 position = glm::clamp((glm::vec3(positions[index]) - position_offset) * inverse_scale, 0.0f, 1.0f);
 
-            const RefPtr<Buffer> tex_coords_buffer = GraphicsDevice::get()->create_buffer({
-                .label = fmt::format("{} Tex Coords", mesh.name),
-                .byte_size = tex_coords.size() * sizeof(glm::vec4),
-                .usage = {BufferUsage::Storage, BufferUsage::ShaderResource},
-            });
-            command_list->write_buffer(tex_coords_buffer, tex_coords.data(), tex_coords.size() * sizeof(glm::vec4), 0);
+                packed_positions[index] = glm::uvec2(glm::packUnorm2x16(glm::vec2(position)), glm::packUnorm2x16(glm::vec2(position.z, 0.0f)));
+                packed_normals[index] = glm::packSnorm2x16(encode_octahedral(glm::vec3(normals[index])));
+                packed_colors[index] = glm::packUnorm4x8(colors[index]);
+                packed_tex_coords[index] = glm::packHalf2x16(glm::vec2(tex_coords[index]));
+            }
 
-            const RefPtr<Buffer> mesh_buffer = GraphicsDevice::get()->create_buffer({
-                .label = fmt::format("{} Mesh Data", mesh.name),
-                .byte_size = sizeof(ShaderMesh),
-                .usage = {BufferUsage::Storage, BufferUsage::ShaderResource},
-            });
+            const GeometryRange vertex_range = geometry_arena->allocate_vertices(static_cast<uint32_t>(positions.size()));
+            geometry_arena->write_vertices(command_list, vertex_range, packed_positions, packed_normals, packed_colors, packed_tex_coords);
 
+            const GeometryArena::VertexPage &vertex_page = geometry_arena->vertex_page(vertex_range.page);
             const ShaderMesh shader_mesh = {
-                .positions = positions_buffer->handle(),
-                .normals = normals_buffer->handle(),
-                .colors = colors_buffer->handle(),
-                .tex_coords = tex_coords_buffer->handle(),
+                .positions = vertex_page.positions_buffer->handle(),
+                .normals = vertex_page.normals_buffer->handle(),
+                .colors = vertex_page.colors_buffer->handle(),
+                .tex_coords = vertex_page.tex_coords_buffer->handle(),
+                .base_vertex = vertex_range.offset,
+                .padding_0 = 0,
+                .padding_1 = 0,
+                .padding_2 = 0,
+                .position_offset = glm::vec4(position_offset, 0.0f),
+                .position_scale = glm::vec4(position_scale, 0.0f),
             };
 
-            command_list->write_buffer(mesh_buffer, &shader_mesh, sizeof(ShaderMesh), 0);
+            const uint32_t mesh_id = geometry_arena->allocate_mesh();
+            geometry_arena->write_mesh(command_list, mesh_id, shader_mesh);
 
-            const RefPtr<Buffer> indices_buffer = GraphicsDevice::get()->create_buffer({
-                .label = fmt::format("{} Indices", mesh.name),
-                .byte_size = indices.size() * sizeof(uint32_t),
-                .usage = BufferUsage::Index,
-            });
-            command_list->write_buffer(indices_buffer, indices.data(), indices.size() * sizeof(uint32_t), 0);
-
-            auto new_mesh = make_ref<Mesh>(
-                std::string(mesh.name),
-                surfaces,
-                positions_buffer,
-                normals_buffer,
-                colors_buffer,
-                tex_coords_buffer,
-                mesh_buffer,
-                indices_buffer);
+            // NOTE: Every index of a mesh with fewer than 65536 vertices fits into 16 bits, which halves its share of the index pages
+            const IndexFormat index_format = positions.size() < g_max_uint16_vertex_count ? IndexFormat::Uint16 : IndexFormat::Uint32;
+            const GeometryRange index_range = geometry_arena->allocate_indices(index_format, static_cast<uint32_t>(indices.size()));
+            geometry_arena->write_indices(command_list, index_range, indices);
+
+            for (GltfSurface &surface : surfaces)
+            {
+                surface.start_index += index_range.offset;
+                for (GltfMeshlet &meshlet : surface.meshlets)
+                {
+                    meshlet.first_index += index_range.offset;
+                }
+            }
+
+            auto new_mesh = make_ref<Mesh>(std::string(mesh.name), std::move(surfaces), geometry_arena, vertex_range, index_range, mesh_id);
             meshes.push_back(new_mesh);
         }
 
+        if (statistics.triangle_count > 0)
+        {
+            const double triangle_count = static_cast<double>(statistics.triangle_count);
+            HE_INFO(
+                "Optimized GLTF '{}': {} -> {} vertices, average cache miss ratio {:.3f} -> {:.3f}",
+                path,
+                statistics.vertex_count_before,
+                statistics.vertex_count_after,
+                static_cast<double>(statistics.transformed_before) / triangle_count,
+                static_cast<double>(statistics.transformed_after) / triangle_count);
+        }
+
         std::vector<RefPtr<Node>> nodes;
         for (const fastgltf::Node &node : asset->nodes)
         {
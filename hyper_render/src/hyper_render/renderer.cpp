@@ -6,12 +6,16 @@
 
 #include "hyper_render/renderer.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 
+#include <glm/gtc/constants.hpp>
+
+#include <hyper_core/assertion.hpp>
 #include <hyper_core/logger.hpp>
+#include <hyper_core/metrics.hpp>
 #include <hyper_core/prerequisites.hpp>
-#include <hyper_ecs/model_component.hpp>
-#include <hyper_ecs/transform_component.hpp>
 #include <hyper_event/event_bus.hpp>
 #include <hyper_platform/input.hpp>
 #include <hyper_platform/window_events.hpp>
@@ -24,80 +28,21 @@
 #include <hyper_rhi/texture.hpp>
 #include <hyper_rhi/texture_view.hpp>
 
+#include "hyper_render/geometry_arena.hpp"
 #include "hyper_render/material.hpp"
 #include "hyper_render/scene.hpp"
 #include "hyper_render/render_passes/grid_pass.hpp"
+#include "hyper_render/render_passes/indirect_pass.hpp"
 #include "hyper_render/render_passes/opaque_pass.hpp"
+#include "hyper_render/render_passes/present_pass.hpp"
 
 #include "shader_interop.h"
 
 namespace hyper_engine
 {
-    Renderer::Renderer()
+    Renderer::Renderer(const RendererDescriptor &descriptor)
         : m_surface(GraphicsDevice::get()->create_surface())
         , m_command_list(GraphicsDevice::get()->create_command_list())
-        , m_render_texture(
-              GraphicsDevice::get()->create_texture({
-                  .label = "Render",
-                  .width = m_surface->width(),
-                  .height = m_surface->height(),
-                  .depth = 1,
-                  .array_size = 1,
-                  .mip_levels = 1,
-                  .format = Format::Bgra8Unorm,
-                  .dimension = Dimension::Texture2D,
-                  .usage = TextureUsage::RenderAttachment,
-              }))
-        , m_render_texture_view(
-              GraphicsDevice::get()->create_texture_view({
-                  .label = "Render",
-                  .texture = m_render_texture,
-                  .subresource_range =
-                      {
-                          .base_mip_level = 0,
-                          .mip_level_count = 1,
-                          .base_array_level = 0,
-                          .array_layer_count = 1,
-                      },
-                  .component_mapping =
-                      {
-                          .r = ComponentSwizzle::Identity,
-                          .g = ComponentSwizzle::Identity,
-                          .b = ComponentSwizzle::Identity,
-                          .a = ComponentSwizzle::Identity,
-                      },
-              }))
-        , m_depth_texture(
-              GraphicsDevice::get()->create_texture({
-                  .label = "Depth",
-                  .width = m_surface->width(),
-                  .height = m_surface->height(),
-                  .depth = 1,
-                  .array_size = 1,
-                  .mip_levels = 1,
-                  .format = Format::D32Sfloat,
-                  .dimension = Dimension::Texture2D,
-                  .usage = TextureUsage::RenderAttachment,
-              }))
-        , m_depth_texture_view(
-              GraphicsDevice::get()->create_texture_view({
-                  .label = "Depth",
-                  .texture = m_depth_texture,
-                  .subresource_range =
-                      {
-                          .base_mip_level = 0,
-                          .mip_level_count = 1,
-                          .base_array_level = 0,
-                          .array_layer_count = 1,
-                      },
-                  .component_mapping =
-                      {
-                          .r = ComponentSwizzle::Identity,
-                          .g = ComponentSwizzle::Identity,
-                          .b = ComponentSwizzle::Identity,
-                          .a = ComponentSwizzle::Identity,
-                      },
-              }))
         , m_camera_buffer(
               GraphicsDevice::get()->create_buffer(
                   {
@@ -112,6 +57,7 @@ namespace hyper_engine
                   .byte_size = sizeof(ShaderScene),
                   .usage = {BufferUsage::Storage, BufferUsage::ShaderResource},
               }))
+        , m_geometry_arena(make_ref<GeometryArena>())
         , m_white_texture(
               GraphicsDevice::get()->create_texture({
                   .label = "White",
@@ -204,9 +150,9 @@ namespace hyper_engine
                   .max_lod = 1.0,
                   .border_color = BorderColor::TransparentBlack,
               }))
-        , m_metallic_roughness_material(m_shader_compiler, m_render_texture, m_depth_texture)
+        , m_metallic_roughness_material(m_shader_compiler, s_render_format, s_depth_format)
     {
-        EventBus::get()->subscribe<WindowResizeEvent>(HE_BIND_FUNCTION(Renderer::on_resize));
+        m_resize_subscription = EventBus::get()->subscribe<WindowResizeEvent, &Renderer::on_resize>(this);
 
         const GltfMetallicRoughness::MaterialResources material_resources = {
             .color_factors = glm::vec4(1.0, 1.0, 1.0, 1.0),
@@ -316,18 +262,50 @@ namespace hyper_engine
             sizeof(pixels),
             0);
 
-        MaterialInstance default_data =
-            m_metallic_roughness_material.write_material(m_command_list, MaterialPassType::MainColor, material_resources);
+        // NOTE: The hues are spread with the golden ratio, so neighbouring variants are easy to tell apart
+        const uint32_t material_count = std::max(descriptor.material_count, 1u);
+        m_material_variants.reserve(material_count - 1);
+        for (uint32_t variant = 1; variant < material_count; ++variant)
+        {
+            const float hue = std::fmod(static_cast<float>(variant) * 0.618034f, 1.0f);
 
-        const RefPtr<LoadedGltf> scene = load_gltf(
-            m_command_list,
-            m_white_texture_view,
-            m_error_texture,
-            m_error_texture_view,
-            m_default_sampler_linear,
-            m_metallic_roughness_material,
-            "./assets/models/DamagedHelmet.glb");
-        m_scenes["DamagedHelmet"] = scene;
+            GltfMetallicRoughness::MaterialResources variant_resources = material_resources;
+            variant_resources.color_factors = glm::vec4(
+                0.5f + 0.5f * std::cos(glm::two_pi<float>() * hue),
+                0.5f + 0.5f * std::cos(glm::two_pi<float>() * (hue - 1.0f / 3.0f)),
+                0.5f + 0.5f * std::cos(glm::two_pi<float>() * (hue - 2.0f / 3.0f)),
+                1.0f);
+
+            m_material_variants.push_back(
+                m_metallic_roughness_material.write_material(m_command_list, MaterialPassType::MainColor, variant_resources));
+        }
+
+        const uint32_t model_count = std::min(std::max(descriptor.model_count, 1u), static_cast<uint32_t>(s_model_paths.size()));
+        if (descriptor.model_count > model_count)
+        {
+            HE_WARN("Only {} models are available, the model indices wrap around", model_count);
+        }
+
+        for (uint32_t model_index = 0; model_index < model_count; ++model_index)
+        {
+            const RefPtr<LoadedGltf> model = load_gltf(
+                m_command_list,
+                m_geometry_arena,
+                m_white_texture_view,
+                m_error_texture,
+                m_error_texture_view,
+                m_default_sampler_linear,
+                m_metallic_roughness_material,
+                s_model_paths[model_index],
+                {
+                    .optimize_meshes = true,
+                });
+            if (model)
+            {
+                m_models.push_back(model);
+            }
+        }
+        HE_ASSERT(!m_models.empty(), "Failed to load any model");
 
         // FIXME: ShaderScene shouldn't be fixed and should actually contain meaningful data
         constexpr ShaderScene shader_scene = {
@@ -344,16 +322,26 @@ namespace hyper_engine
         GraphicsDevice::get()->execute(m_command_list);
         GraphicsDevice::get()->wait_for_idle();
 
-        m_opaque_pass = make_own<OpaquePass>(m_render_texture_view, m_depth_texture_view, m_scene_buffer);
+        m_opaque_pass = make_own<OpaquePass>(m_render_texture_view, m_depth_texture_view, m_scene_buffer, m_geometry_arena);
+        // NOTE: The indirect shaders need the draw parameters, which are only enabled on devices supporting the GPU driven path
+        if (GraphicsDevice::get()->indirect_draw_supported())
+        {
+            m_indirect_pass =
+                make_own<IndirectPass>(m_shader_compiler, m_render_texture_view, m_depth_texture_view, m_scene_buffer, m_geometry_arena);
+        }
 
-        m_grid_pass = make_own<GridPass>(m_shader_compiler, m_render_texture, m_render_texture_view, m_depth_texture, m_depth_texture_view);
+        m_grid_pass = make_own<GridPass>(m_shader_compiler, s_render_format, m_render_texture_view, s_depth_format, m_depth_texture_view);
+        m_present_pass = make_own<PresentPass>(m_shader_compiler, m_render_texture_view, m_surface->format(), m_output_texture_view);
 
         // m_imgui_pass = make<ImGuiPass>(m_surface);
 
         HE_INFO("Created Renderer");
     }
 
-    Renderer::~Renderer() = default;
+    Renderer::~Renderer()
+    {
+        EventBus::get()->unsubscribe(m_resize_subscription);
+    }
 
     void Renderer::begin_frame(const CameraData &camera)
     {
@@ -363,6 +351,8 @@ namespace hyper_engine
         const glm::mat4 view_matrix = camera.view;
         const glm::mat4 projection_matrix = camera.projection;
         const glm::mat4 view_projection_matrix = projection_matrix * view_matrix;
+        m_frustum = Frustum::from_matrix(view_projection_matrix);
+        m_camera_position = camera.position;
         const ShaderCamera shader_camera = {
             .position = glm::vec4(camera.position, 1.0),
             .view = camera.view,
@@ -385,6 +375,7 @@ namespace hyper_engine
         GraphicsDevice::get()->wait_for_idle();
 
         GraphicsDevice::get()->begin_frame(m_surface, m_frame_index);
+        m_geometry_arena->begin_frame(m_frame_index);
 
         m_command_list->begin();
     }
@@ -404,24 +395,22 @@ namespace hyper_engine
         GraphicsDevice::get()->present(m_surface);
     }
 
-    void Renderer::render_scene(const Scene &scene)
+    void Renderer::render_scene(Scene &scene)
     {
-        m_draw_context.opaque_surfaces.clear();
-        m_draw_context.transparent_surfaces.clear();
-
-        // NOTE: Here we are appending the current models to the render list
-        const auto view = scene.registry().view<const TransformComponent, const ModelComponent>();
-        view.each(
-            [this](const TransformComponent &transform, const ModelComponent &model)
-            {
-                glm::mat4 model_matrix = glm::mat4(1.0f);
-                model_matrix = glm::scale(model_matrix, transform.scale);
-                // FIXME: Add rotation
-                model_matrix = glm::translate(model_matrix, transform.translation);
+        // NOTE: Only added, changed, removed or moved models are written to the render list
+        RenderObjectTable &render_objects = scene.render_objects();
+        render_objects.sync(m_models, m_material_variants);
 
-                // FIXME: Don't hardcode the model
-                m_scenes["DamagedHelmet"]->draw(model_matrix, m_draw_context);
-            });
+        // NOTE: The GPU driven path culls the opaque surfaces in a compute pass
+        if (m_gpu_driven)
+        {
+            m_visible_draw_context.opaque_surfaces.clear();
+        }
+        else
+        {
+            cull_render_objects(render_objects.draw_context().opaque_surfaces, m_visible_draw_context.opaque_surfaces);
+        }
+        cull_render_objects(render_objects.draw_context().transparent_surfaces, m_visible_draw_context.transparent_surfaces);
 
         // NOTE: The rendering should be in the order of
         // 1. Opaque Pass
@@ -429,197 +418,203 @@ namespace hyper_engine
         // 3. If the editor enabled the grid, then do the grid pass
         // 3. If the editor enabled the gui, then do the gui pass
 
-        // FIXME: Add automatic barriers
         // FIXME: Add debug renderer
         // FIXME: Toggle grid & ui
 
-        // Transition render texture to color attachment and depth texture to depth stencil attachment
-        m_command_list->insert_barriers({
-            .memory_barriers = {},
-            .buffer_memory_barriers = {},
-            .texture_memory_barriers =
+        // FIXME: Add error if current texture is asked before the frame began
+        const RefPtr<Texture> swapchain_texture = m_surface->current_texture();
+
+        const RenderGraphResource render_target = m_render_graph.create_texture({
+            .label = "Render",
+            .width = m_surface->width(),
+            .height = m_surface->height(),
+            .depth = 1,
+            .array_size = 1,
+            .mip_levels = 1,
+            .format = s_render_format,
+            .dimension = Dimension::Texture2D,
+            .usage = {TextureUsage::RenderAttachment, TextureUsage::ShaderResource},
+        });
+        const RenderGraphResource depth_target = m_render_graph.create_texture({
+            .label = "Depth",
+            .width = m_surface->width(),
+            .height = m_surface->height(),
+            .depth = 1,
+            .array_size = 1,
+            .mip_levels = 1,
+            .format = s_depth_format,
+            .dimension = Dimension::Texture2D,
+            .usage = TextureUsage::RenderAttachment,
+        });
+        // NOTE: The output is first written after the last depth access, so the allocator places it in the memory of the depth
+        const RenderGraphResource output_target = m_render_graph.create_texture({
+            .label = "Output",
+            .width = m_surface->width(),
+            .height = m_surface->height(),
+            .depth = 1,
+            .array_size = 1,
+            .mip_levels = 1,
+            .format = m_surface->format(),
+            .dimension = Dimension::Texture2D,
+            .usage = TextureUsage::RenderAttachment,
+        });
+        const RenderGraphResource swapchain_target = m_render_graph.import_texture(swapchain_texture, ResourceUsage::Present);
+
+        if (m_gpu_driven)
+        {
+            m_render_graph.add_pass({
+                .label = "Indirect Opaque",
+                .accesses =
+                    {
+                        {
+                            .resource = render_target,
+                            .usage = ResourceUsage::ColorAttachment,
+                        },
+                        {
+                            .resource = depth_target,
+                            .usage = ResourceUsage::DepthStencilAttachment,
+                        },
+                    },
+                .side_effects = false,
+                .execute =
+                    [this, &render_objects](const RefPtr<CommandList> &command_list)
+                {
+                    m_indirect_pass->render(command_list, render_objects, m_frustum);
+                },
+            });
+        }
+
+        // NOTE: The transparent surfaces are blended on top of the indirect draws
+        m_render_graph.add_pass({
+            .label = "Opaque",
+            .accesses =
                 {
                     {
-                        .stage_before = BarrierPipelineStage::AllCommands,
-                        .stage_after = BarrierPipelineStage::ColorAttachmentOutput,
-                        .access_before = BarrierAccess::None,
-                        .access_after = BarrierAccess::ColorAttachmentWrite,
-                        .layout_before = BarrierTextureLayout::Undefined,
-                        .layout_after = BarrierTextureLayout::ColorAttachment,
-                        .texture = m_render_texture,
-                        .subresource_range =
-                            {
-                                .base_mip_level = 0,
-                                .mip_level_count = 1,
-                                .base_array_level = 0,
-                                .array_layer_count = 1,
-                            },
+                        .resource = render_target,
+                        .usage = ResourceUsage::ColorAttachment,
                     },
                     {
-                        .stage_before = BarrierPipelineStage::AllCommands,
-                        .stage_after = BarrierPipelineStage::LateFragmentTests,
-                        .access_before = BarrierAccess::None,
-                        .access_after = BarrierAccess::DepthStencilAttachmentWrite,
-                        .layout_before = BarrierTextureLayout::Undefined,
-                        .layout_after = BarrierTextureLayout::DepthStencilAttachment,
-                        .texture = m_depth_texture,
-                        .subresource_range =
-                            {
-                                .base_mip_level = 0,
-                                .mip_level_count = 1,
-                                .base_array_level = 0,
-                                .array_layer_count = 1,
-                            },
+                        .resource = depth_target,
+                        .usage = ResourceUsage::DepthStencilAttachment,
                     },
                 },
+            .side_effects = false,
+            .execute =
+                [this](const RefPtr<CommandList> &command_list)
+            {
+                const LoadOperation load_operation = m_gpu_driven ? LoadOperation::Load : LoadOperation::Clear;
+                m_opaque_pass->render(command_list, m_visible_draw_context, m_camera_position, load_operation);
+            },
         });
 
-        m_opaque_pass->render(m_command_list, m_draw_context);
-
-        // NOTE: Ensure depth image was written
-        m_command_list->insert_barriers({
-            .memory_barriers = {},
-            .buffer_memory_barriers = {},
-            .texture_memory_barriers =
+        m_render_graph.add_pass({
+            .label = "Grid",
+            .accesses =
                 {
                     {
-                        .stage_before = BarrierPipelineStage::LateFragmentTests,
-                        .stage_after = BarrierPipelineStage::EarlyFragmentTests,
-                        .access_before = BarrierAccess::DepthStencilAttachmentWrite,
-                        .access_after = BarrierAccess::DepthStencilAttachmentWrite,
-                        .layout_before = BarrierTextureLayout::DepthStencilAttachment,
-                        .layout_after = BarrierTextureLayout::DepthStencilAttachment,
-                        .texture = m_depth_texture,
-                        .subresource_range =
-                            {
-                                .base_mip_level = 0,
-                                .mip_level_count = 1,
-                                .base_array_level = 0,
-                                .array_layer_count = 1,
-                            },
+                        .resource = render_target,
+                        .usage = ResourceUsage::ColorAttachment,
+                    },
+                    {
+                        .resource = depth_target,
+                        .usage = ResourceUsage::DepthStencilAttachment,
                     },
                 },
+            .side_effects = false,
+            .execute =
+                [this](const RefPtr<CommandList> &command_list)
+            {
+                m_grid_pass->render(command_list);
+            },
         });
 
-        m_grid_pass->render(m_command_list);
-
-        // FIXME: Add error if current texture is asked before the frame began
-        const RefPtr<Texture> swapchain_texture = m_surface->current_texture();
-        const RefPtr<TextureView> swapchain_texture_view = m_surface->current_texture_view();
-
-        // NOTE: Transitioning the render and swapchain image for transfer
-        m_command_list->insert_barriers({
-            .memory_barriers = {},
-            .buffer_memory_barriers = {},
-            .texture_memory_barriers =
+        m_render_graph.add_pass({
+            .label = "Present",
+            .accesses =
                 {
                     {
-                        .stage_before = BarrierPipelineStage::ColorAttachmentOutput,
-                        .stage_after = BarrierPipelineStage::AllTransfer,
-                        .access_before = BarrierAccess::ColorAttachmentWrite,
-                        .access_after = BarrierAccess::TransferRead,
-                        .layout_before = BarrierTextureLayout::ColorAttachment,
-                        .layout_after = BarrierTextureLayout::TransferSrc,
-                        .texture = m_render_texture,
-                        .subresource_range =
-                            {
-                                .base_mip_level = 0,
-                                .mip_level_count = 1,
-                                .base_array_level = 0,
-                                .array_layer_count = 1,
-                            },
+                        .resource = render_target,
+                        .usage = ResourceUsage::ShaderRead,
                     },
                     {
-                        .stage_before = BarrierPipelineStage::AllCommands,
-                        .stage_after = BarrierPipelineStage::AllTransfer,
-                        .access_before = BarrierAccess::None,
-                        .access_after = BarrierAccess::TransferWrite,
-                        .layout_before = BarrierTextureLayout::Undefined,
-                        .layout_after = BarrierTextureLayout::TransferDst,
-                        .texture = swapchain_texture,
-                        .subresource_range =
-                            {
-                                .base_mip_level = 0,
-                                .mip_level_count = 1,
-                                .base_array_level = 0,
-                                .array_layer_count = 1,
-                            },
+                        .resource = output_target,
+                        .usage = ResourceUsage::ColorAttachment,
                     },
                 },
-        });
-
-        m_command_list->copy_texture_to_texture(
-            m_render_texture,
+            .side_effects = false,
+            .execute =
+                [this](const RefPtr<CommandList> &command_list)
             {
-                .x = 0,
-                .y = 0,
-                .z = 0,
+                m_present_pass->render(command_list);
             },
-            0,
-            0,
-            swapchain_texture,
-            {
-                .x = 0,
-                .y = 0,
-                .z = 0,
-            },
-            0,
-            0,
-            {
-                .width = m_render_texture->width(),
-                .height = m_render_texture->height(),
-                .depth = m_render_texture->depth(),
-            });
+        });
 
-        m_command_list->insert_barriers({
-            .memory_barriers = {},
-            .buffer_memory_barriers = {},
-            .texture_memory_barriers =
+        m_render_graph.add_pass({
+            .label = "Swapchain Copy",
+            .accesses =
                 {
                     {
-                        .stage_before = BarrierPipelineStage::AllTransfer,
-                        .stage_after = BarrierPipelineStage::ColorAttachmentOutput,
-                        .access_before = BarrierAccess::TransferWrite,
-                        .access_after = BarrierAccess::ColorAttachmentWrite,
-                        .layout_before = BarrierTextureLayout::TransferDst,
-                        .layout_after = BarrierTextureLayout::ColorAttachment,
-                        .texture = swapchain_texture,
-                        .subresource_range =
-                            {
-                                .base_mip_level = 0,
-                                .mip_level_count = 1,
-                                .base_array_level = 0,
-                                .array_layer_count = 1,
-                            },
+                        .resource = output_target,
+                        .usage = ResourceUsage::TransferRead,
+                    },
+                    {
+                        .resource = swapchain_target,
+                        .usage = ResourceUsage::TransferWrite,
                     },
                 },
+            .side_effects = false,
+            .execute =
+                [this, &swapchain_texture](const RefPtr<CommandList> &command_list)
+            {
+                command_list->copy_texture_to_texture(
+                    m_output_texture,
+                    {
+                        .x = 0,
+                        .y = 0,
+                        .z = 0,
+                    },
+                    0,
+                    0,
+                    swapchain_texture,
+                    {
+                        .x = 0,
+                        .y = 0,
+                        .z = 0,
+                    },
+                    0,
+                    0,
+                    {
+                        .width = m_output_texture->width(),
+                        .height = m_output_texture->height(),
+                        .depth = m_output_texture->depth(),
+                    });
+            },
         });
 
         // m_imgui_pass->render(m_command_list, swapchain_texture_view);
 
-        m_command_list->insert_barriers({
-            .memory_barriers = {},
-            .buffer_memory_barriers = {},
-            .texture_memory_barriers =
-                {
-                    {
-                        .stage_before = BarrierPipelineStage::ColorAttachmentOutput,
-                        .stage_after = BarrierPipelineStage::AllCommands,
-                        .access_before = BarrierAccess::ColorAttachmentWrite,
-                        .access_after = BarrierAccess::None,
-                        .layout_before = BarrierTextureLayout::ColorAttachment,
-                        .layout_after = BarrierTextureLayout::Present,
-                        .texture = swapchain_texture,
-                        .subresource_range =
-                            {
-                                .base_mip_level = 0,
-                                .mip_level_count = 1,
-                                .base_array_level = 0,
-                                .array_layer_count = 1,
-                            },
-                    },
-                },
-        });
+        m_render_graph.compile();
+
+        // NOTE: The passes reference these members, so they have to point to the textures of this frame before executing
+        m_render_texture = m_render_graph.texture(render_target);
+        m_render_texture_view = m_render_graph.texture_view(render_target);
+        m_depth_texture = m_render_graph.texture(depth_target);
+        m_depth_texture_view = m_render_graph.texture_view(depth_target);
+        m_output_texture = m_render_graph.texture(output_target);
+        m_output_texture_view = m_render_graph.texture_view(output_target);
+
+        m_render_graph.execute(m_command_list);
+    }
+
+    void Renderer::set_gpu_driven(const bool gpu_driven)
+    {
+        if (gpu_driven && !m_indirect_pass)
+        {
+            HE_ERROR("Failed to enable the GPU driven path: The device doesn't support indirect count draws");
+            return;
+        }
+
+        m_gpu_driven = gpu_driven;
     }
 
     Renderer *&Renderer::get()
@@ -628,75 +623,35 @@ namespace hyper_engine
         return renderer;
     }
 
-    void Renderer::create_textures(const uint32_t width, const uint32_t height)
+    void Renderer::cull_render_objects(const std::span<const RenderObject> render_objects, std::vector<RenderObject> &visible_render_objects)
     {
-        m_render_texture = GraphicsDevice::get()->create_texture({
-            .label = "Render",
-            .width = width,
-            .height = height,
-            .depth = 1,
-            .array_size = 1,
-            .mip_levels = 1,
-            .format = Format::Bgra8Unorm,
-            .dimension = Dimension::Texture2D,
-            .usage = TextureUsage::RenderAttachment,
-        });
+        static Counter &culled_counter = MetricsRegistry::get()->counter("render.culling.culled");
 
-        m_render_texture_view = GraphicsDevice::get()->create_texture_view({
-            .label = "Render",
-            .texture = m_render_texture,
-            .subresource_range =
-                {
-                    .base_mip_level = 0,
-                    .mip_level_count = 1,
-                    .base_array_level = 0,
-                    .array_layer_count = 1,
-                },
-            .component_mapping =
-                {
-                    .r = ComponentSwizzle::Identity,
-                    .g = ComponentSwizzle::Identity,
-                    .b = ComponentSwizzle::Identity,
-                    .a = ComponentSwizzle::Identity,
-                },
-        });
+        m_cull_boxes.clear();
+        m_cull_boxes.reserve(render_objects.size());
+        for (const RenderObject &render_object : render_objects)
+        {
+            m_cull_boxes.push_back(render_object.bounds);
+        }
 
-        m_depth_texture = GraphicsDevice::get()->create_texture({
-            .label = "Depth",
-            .width = width,
-            .height = height,
-            .depth = 1,
-            .array_size = 1,
-            .mip_levels = 1,
-            .format = Format::D32Sfloat,
-            .dimension = Dimension::Texture2D,
-            .usage = TextureUsage::RenderAttachment,
-        });
+        m_visibility.resize(render_objects.size());
+        cull_boxes(m_frustum, m_cull_boxes, m_visibility);
 
-        m_depth_texture_view = GraphicsDevice::get()->create_texture_view({
-            .label = "Depth",
-            .texture = m_depth_texture,
-            .subresource_range =
-                {
-                    .base_mip_level = 0,
-                    .mip_level_count = 1,
-                    .base_array_level = 0,
-                    .array_layer_count = 1,
-                },
-            .component_mapping =
-                {
-                    .r = ComponentSwizzle::Identity,
-                    .g = ComponentSwizzle::Identity,
-                    .b = ComponentSwizzle::Identity,
-                    .a = ComponentSwizzle::Identity,
-                },
-        });
+        visible_render_objects.clear();
+        for (size_t index = 0; index < render_objects.size(); ++index)
+        {
+            if (m_visibility[index] != 0)
+            {
+                visible_render_objects.push_back(render_objects[index]);
+            }
+        }
+
+        culled_counter.add(render_objects.size() - visible_render_objects.size());
     }
 
     void Renderer::on_resize(const WindowResizeEvent &event)
     {
+        // NOTE: The render targets follow the surface size, the render graph recreates them on the next frame
         m_surface->resize(event.width(), event.height());
-
-        create_textures(event.width(), event.height());
     }
 } // namespace hyper_engine
\ No newline at end of file
@@ -8,6 +8,20 @@
 
 namespace hyper_engine
 {
+    Scene::Scene()
+        : m_transform_hierarchy(m_registry)
+        , m_spatial_index(m_registry, m_transform_hierarchy)
+        , m_render_objects(m_registry, m_transform_hierarchy)
+    {
+    }
+
+    void Scene::update()
+    {
+        m_transform_hierarchy.update();
+        m_spatial_index.update();
+        m_render_objects.update();
+    }
+
     entt::registry &Scene::registry()
     {
         return m_registry;
@@ -17,4 +31,34 @@ namespace hyper_engine
     {
         return m_registry;
     }
+
+    TransformHierarchy &Scene::transform_hierarchy()
+    {
+        return m_transform_hierarchy;
+    }
+
+    const TransformHierarchy &Scene::transform_hierarchy() const
+    {
+        return m_transform_hierarchy;
+    }
+
+    SpatialIndex &Scene::spatial_index()
+    {
+        return m_spatial_index;
+    }
+
+    const SpatialIndex &Scene::spatial_index() const
+    {
+        return m_spatial_index;
+    }
+
+    RenderObjectTable &Scene::render_objects()
+    {
+        return m_render_objects;
+    }
+
+    const RenderObjectTable &Scene::render_objects() const
+    {
+        return m_render_objects;
+    }
 } // namespace hyper_engine
\ No newline at end of file
@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_render/scene_serializer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <hyper_core/filesystem.hpp>
+#include <hyper_core/logger.hpp>
+#include <hyper_core/mapped_file.hpp>
+#include <hyper_ecs/hierarchy_component.hpp>
+#include <hyper_ecs/model_component.hpp>
+#include <hyper_ecs/transform_component.hpp>
+
+#include "hyper_render/scene.hpp"
+
+namespace hyper_engine
+{
+    // NOTE: Transforms are copied byte for byte, the format therefore assumes little endian machines with the same float layout
+    static_assert(std::is_trivially_copyable_v<TransformComponent>);
+    static_assert(sizeof(TransformComponent) == 9 * sizeof(float));
+
+    static constexpr uint32_t g_no_parent = std::numeric_limits<uint32_t>::max();
+
+    static void append_bytes(std::vector<uint8_t> &buffer, const void *data, const size_t size)
+    {
+        const size_t offset = buffer.size();
+        buffer.resize(offset + size);
+        std::memcpy(buffer.data() + offset, data, size);
+    }
+
+    static uint64_t align_buffer(std::vector<uint8_t> &buffer)
+    {
+        const uint64_t alignment = SceneSerializer::s_column_alignment;
+        buffer.resize((buffer.size() + alignment - 1) & ~(alignment - 1));
+        return buffer.size();
+    }
+
+    bool SceneSerializer::save(const Scene &scene, const std::string_view path)
+    {
+        const entt::registry &registry = scene.registry();
+
+        const auto transform_view = registry.view<const TransformComponent>();
+        const std::vector<entt::entity> entities(transform_view.begin(), transform_view.end());
+
+        std::unordered_map<entt::entity, uint32_t> indices;
+        indices.reserve(entities.size());
+        for (uint32_t index = 0; index < entities.size(); ++index)
+        {
+            indices.emplace(entities[index], index);
+        }
+
+        std::vector<TransformComponent> transforms;
+        transforms.reserve(entities.size());
+        for (const entt::entity entity : entities)
+        {
+            transforms.push_back(registry.get<TransformComponent>(entity));
+        }
+
+        std::vector<uint32_t> hierarchy_entities;
+        std::vector<uint32_t> hierarchy_parents;
+        std::vector<uint32_t> model_entities;
+        for (uint32_t index = 0; index < entities.size(); ++index)
+        {
+            if (const HierarchyComponent *hierarchy = registry.try_get<HierarchyComponent>(entities[index]))
+            {
+                const auto parent = indices.find(hierarchy->parent);
+
+                hierarchy_entities.push_back(index);
+                hierarchy_parents.push_back(parent != indices.end() ? parent->second : g_no_parent);
+            }
+
+            if (registry.all_of<ModelComponent>(entities[index]))
+            {
+                model_entities.push_back(index);
+            }
+        }
+
+        std::vector<ColumnHeader> column_headers = {
+            {
+                .column = Column::Transform,
+                .element_size = sizeof(TransformComponent),
+                .count = static_cast<uint32_t>(transforms.size()),
+            },
+            {
+                .column = Column::Hierarchy,
+                .element_size = sizeof(uint32_t),
+                .count = static_cast<uint32_t>(hierarchy_entities.size()),
+            },
+            {
+                .column = Column::Model,
+                .element_size = 0,
+                .count = static_cast<uint32_t>(model_entities.size()),
+            },
+        };
+
+        const FileHeader file_header = {
+            .entity_count = static_cast<uint32_t>(entities.size()),
+            .column_count = static_cast<uint32_t>(column_headers.size()),
+        };
+
+        std::vector<uint8_t> buffer;
+        append_bytes(buffer, &file_header, sizeof(FileHeader));
+
+        const size_t column_headers_offset = buffer.size();
+        buffer.resize(buffer.size() + column_headers.size() * sizeof(ColumnHeader));
+
+        // NOTE: Columns covering every entity are stored in entity order without an entity list
+        column_headers[0].data_offset = align_buffer(buffer);
+        append_bytes(buffer, transforms.data(), transforms.size() * sizeof(TransformComponent));
+
+        column_headers[1].entities_offset = align_buffer(buffer);
+        append_bytes(buffer, hierarchy_entities.data(), hierarchy_entities.size() * sizeof(uint32_t));
+        column_headers[1].data_offset = align_buffer(buffer);
+        append_bytes(buffer, hierarchy_parents.data(), hierarchy_parents.size() * sizeof(uint32_t));
+
+        column_headers[2].entities_offset = align_buffer(buffer);
+        append_bytes(buffer, model_entities.data(), model_entities.size() * sizeof(uint32_t));
+
+        std::memcpy(buffer.data() + column_headers_offset, column_headers.data(), column_headers.size() * sizeof(ColumnHeader));
+
+        if (!filesystem::write_file(path, buffer))
+        {
+            HE_ERROR("Failed to write scene '{}'", path);
+            return false;
+        }
+
+        return true;
+    }
+
+    bool SceneSerializer::load(Scene &scene, const std::string_view path)
+    {
+        const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+        const MappedFile file(path);
+        if (!file.is_valid())
+        {
+            HE_ERROR("Failed to open scene '{}'", path);
+            return false;
+        }
+
+        const std::span<const uint8_t> data = file.data();
+        if (data.size() < sizeof(FileHeader))
+        {
+            HE_ERROR("Failed to load scene '{}': The file is too small", path);
+            return false;
+        }
+
+        FileHeader file_header = {};
+        std::memcpy(&file_header, data.data(), sizeof(FileHeader));
+        if (file_header.magic != s_magic || file_header.version != s_version)
+        {
+            HE_ERROR("Failed to load scene '{}': Unsupported format version {}", path, file_header.version);
+            return false;
+        }
+
+        if (data.size() < sizeof(FileHeader) + file_header.column_count * sizeof(ColumnHeader))
+        {
+            HE_ERROR("Failed to load scene '{}': The column headers are truncated", path);
+            return false;
+        }
+
+        std::vector<ColumnHeader> column_headers(file_header.column_count);
+        std::memcpy(column_headers.data(), data.data() + sizeof(FileHeader), column_headers.size() * sizeof(ColumnHeader));
+
+        const auto contains_range = [&data](const uint64_t offset, const uint64_t size)
+        {
+            return offset % s_column_alignment == 0 && offset <= data.size() && size <= data.size() - offset;
+        };
+
+        // NOTE: Every column is validated before the first entity is created, so a failed load leaves the scene untouched. Inserting
+        //       a component twice into the same entity isn't allowed, so neither repeated columns nor repeated entities are accepted.
+        std::vector<Column> seen_columns;
+        std::vector<uint8_t> referenced_entities(file_header.entity_count, 0);
+        for (const ColumnHeader &column_header : column_headers)
+        {
+            if (std::ranges::find(seen_columns, column_header.column) != seen_columns.end())
+            {
+                HE_ERROR("Failed to load scene '{}': The column {} is stored twice", path, static_cast<uint32_t>(column_header.column));
+                return false;
+            }
+            seen_columns.push_back(column_header.column);
+
+            const bool covers_all = column_header.entities_offset == 0;
+            if ((covers_all && column_header.count != file_header.entity_count) ||
+                (!covers_all && !contains_range(column_header.entities_offset, uint64_t{column_header.count} * sizeof(uint32_t))) ||
+                !contains_range(column_header.data_offset, uint64_t{column_header.count} * column_header.element_size))
+            {
+                HE_ERROR("Failed to load scene '{}': The column {} is out of bounds", path, static_cast<uint32_t>(column_header.column));
+                return false;
+            }
+
+            if (!covers_all)
+            {
+                const uint32_t *indices = reinterpret_cast<const uint32_t *>(data.data() + column_header.entities_offset);
+                const std::span<const uint32_t> column_indices(indices, column_header.count);
+
+                std::ranges::fill(referenced_entities, 0);
+                for (const uint32_t index : column_indices)
+                {
+                    if (index >= file_header.entity_count)
+                    {
+                        HE_ERROR(
+                            "Failed to load scene '{}': The column {} references unknown entities",
+                            path,
+                            static_cast<uint32_t>(column_header.column));
+                        return false;
+                    }
+
+                    if (referenced_entities[index] != 0)
+                    {
+                        HE_ERROR(
+                            "Failed to load scene '{}': The column {} references entity {} twice",
+                            path,
+                            static_cast<uint32_t>(column_header.column),
+                            index);
+                        return false;
+                    }
+
+                    referenced_entities[index] = 1;
+                }
+            }
+
+            if ((column_header.column == Column::Transform && column_header.element_size != sizeof(TransformComponent)) ||
+                (column_header.column == Column::Hierarchy && column_header.element_size != sizeof(uint32_t)))
+            {
+                HE_ERROR("Failed to load scene '{}': The layout of column {} doesn't match", path, static_cast<uint32_t>(column_header.column));
+                return false;
+            }
+        }
+
+        entt::registry &registry = scene.registry();
+
+        std::vector<entt::entity> entities(file_header.entity_count);
+        registry.create(entities.begin(), entities.end());
+
+        std::vector<entt::entity> column_entities;
+        for (const ColumnHeader &column_header : column_headers)
+        {
+            const uint8_t *column_data = data.data() + column_header.data_offset;
+
+            std::span<const entt::entity> target_entities = entities;
+            if (column_header.entities_offset != 0)
+            {
+                const uint32_t *indices = reinterpret_cast<const uint32_t *>(data.data() + column_header.entities_offset);
+
+                column_entities.resize(column_header.count);
+                for (uint32_t index = 0; index < column_header.count; ++index)
+                {
+                    column_entities[index] = entities[indices[index]];
+                }
+
+                target_entities = column_entities;
+            }
+
+            switch (column_header.column)
+            {
+            case Column::Transform:
+            {
+                const TransformComponent *transforms = reinterpret_cast<const TransformComponent *>(column_data);
+                registry.insert<TransformComponent>(target_entities.begin(), target_entities.end(), transforms);
+                break;
+            }
+            case Column::Hierarchy:
+            {
+                const uint32_t *parents = reinterpret_cast<const uint32_t *>(column_data);
+
+                std::vector<HierarchyComponent> hierarchies(column_header.count);
+                for (uint32_t index = 0; index < column_header.count; ++index)
+                {
+                    hierarchies[index].parent = parents[index] < entities.size() ? entities[parents[index]] : entt::null;
+                }
+
+                registry.insert<HierarchyComponent>(target_entities.begin(), target_entities.end(), hierarchies.begin());
+                break;
+            }
+            case Column::Model:
+                // FIXME: Store a reference to the model asset, once models aren't hardcoded anymore
+                registry.insert<ModelComponent>(target_entities.begin(), target_entities.end());
+                break;
+            default:
+                HE_WARN("Skipping unknown scene column {}", static_cast<uint32_t>(column_header.column));
+                break;
+            }
+        }
+
+        const std::chrono::steady_clock::time_point end_time = std::chrono::steady_clock::now();
+        const std::chrono::duration<double, std::milli> elapsed_milliseconds = end_time - start_time;
+        HE_INFO("Loaded scene '{}' with {} entities in {:.2f}ms", path, entities.size(), elapsed_milliseconds.count());
+
+        return true;
+    }
+
+    bool SceneSerializer::export_text(const Scene &scene, const std::string_view path)
+    {
+        const entt::registry &registry = scene.registry();
+
+        const auto transform_view = registry.view<const TransformComponent>();
+        const std::vector<entt::entity> entities(transform_view.begin(), transform_view.end());
+
+        std::unordered_map<entt::entity, uint32_t> indices;
+        indices.reserve(entities.size());
+        for (uint32_t index = 0; index < entities.size(); ++index)
+        {
+            indices.emplace(entities[index], index);
+        }
+
+        std::string text = fmt::format("# hyper_engine scene version {}\n", s_version);
+        for (uint32_t index = 0; index < entities.size(); ++index)
+        {
+            const entt::entity entity = entities[index];
+            const TransformComponent &transform = registry.get<TransformComponent>(entity);
+
+            fmt::format_to(
+                std::back_inserter(text),
+                "entity {}\n"
+                "    transform translation=({}, {}, {}) rotation=({}, {}, {}) scale=({}, {}, {})\n",
+                index,
+                transform.translation.x,
+                transform.translation.y,
+                transform.translation.z,
+                transform.rotation.x,
+                transform.rotation.y,
+                transform.rotation.z,
+                transform.scale.x,
+                transform.scale.y,
+                transform.scale.z);
+
+            if (const HierarchyComponent *hierarchy = registry.try_get<HierarchyComponent>(entity))
+            {
+                const auto parent = indices.find(hierarchy->parent);
+                if (parent != indices.end())
+                {
+                    fmt::format_to(std::back_inserter(text), "    parent {}\n", parent->second);
+                }
+            }
+
+            if (registry.all_of<ModelComponent>(entity))
+            {
+                text += "    model\n";
+            }
+        }
+
+        const std::span<const uint8_t> bytes(reinterpret_cast<const uint8_t *>(text.data()), text.size());
+        if (!filesystem::write_file(path, bytes))
+        {
+            HE_ERROR("Failed to write scene '{}'", path);
+            return false;
+        }
+
+        return true;
+    }
+} // namespace hyper_engine
\ No newline at end of file
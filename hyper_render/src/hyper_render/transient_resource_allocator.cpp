@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_render/transient_resource_allocator.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+
+#include <fmt/format.h>
+
+#include <hyper_core/assertion.hpp>
+#include <hyper_core/metrics.hpp>
+#include <hyper_rhi/graphics_device.hpp>
+#include <hyper_rhi/texture_heap.hpp>
+#include <hyper_rhi/texture_view.hpp>
+
+namespace hyper_engine
+{
+    static uint64_t align_up(const uint64_t value, const uint64_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    static bool lifetimes_overlap(const TransientTextureRequest &lhs, const TransientTextureRequest &rhs)
+    {
+        return lhs.first_level <= rhs.last_level && rhs.first_level <= lhs.last_level;
+    }
+
+    std::span<const TransientTexture> TransientResourceAllocator::allocate(const std::span<const TransientTextureRequest> requests)
+    {
+        // NOTE: Most frames declare the same targets as the previous one, so the textures are only replaced on resizes or graph changes
+        if (!std::ranges::equal(requests, m_requests))
+        {
+            m_requests.assign(requests.begin(), requests.end());
+            place_textures(requests);
+        }
+
+        return m_textures;
+    }
+
+    void TransientResourceAllocator::place_textures(const std::span<const TransientTextureRequest> requests)
+    {
+        static Gauge &heap_bytes_gauge = MetricsRegistry::get()->gauge("render.transient.heap_bytes");
+        static Gauge &aliased_bytes_gauge = MetricsRegistry::get()->gauge("render.transient.aliased_bytes");
+
+        // NOTE: The old textures are only destroyed once the frames using them have finished
+        m_heaps.clear();
+        m_textures.clear();
+        m_textures.resize(requests.size());
+
+        std::vector<TextureMemoryRequirements> memory_requirements(requests.size());
+        std::vector<uint32_t> order;
+        for (uint32_t index = 0; index < requests.size(); ++index)
+        {
+            const TextureDescriptor &descriptor = requests[index].descriptor;
+            if (descriptor.usage & TextureUsage::Transient)
+            {
+                m_textures[index].texture = GraphicsDevice::get()->create_texture(descriptor);
+                m_textures[index].texture_view = TransientResourceAllocator::create_texture_view(m_textures[index].texture);
+                continue;
+            }
+
+            memory_requirements[index] = GraphicsDevice::get()->texture_memory_requirements(descriptor);
+            order.push_back(index);
+        }
+
+        // NOTE: Placing the largest textures first keeps the heaps tight
+        std::ranges::stable_sort(
+            order,
+            [&memory_requirements](const uint32_t lhs, const uint32_t rhs)
+            {
+                return memory_requirements[lhs].byte_size > memory_requirements[rhs].byte_size;
+            });
+
+        std::vector<HeapPlacement> heaps;
+        std::vector<uint64_t> offsets(requests.size(), 0);
+        std::vector<uint64_t> candidates;
+        uint64_t requested_bytes = 0;
+        for (const uint32_t index : order)
+        {
+            const TextureMemoryRequirements &requirements = memory_requirements[index];
+            requested_bytes += requirements.byte_size;
+
+            auto heap = std::ranges::find_if(
+                heaps,
+                [&requirements](const HeapPlacement &placement)
+                {
+                    return (placement.memory_type_bits & requirements.memory_type_bits) != 0;
+                });
+
+            if (heap == heaps.end())
+            {
+                heaps.push_back({
+                    .memory_type_bits = requirements.memory_type_bits,
+                    .alignment = 1,
+                    .byte_size = 0,
+                    .textures = {},
+                });
+                heap = std::prev(heaps.end());
+            }
+
+            const auto overlaps = [&requests, &memory_requirements, &offsets, index](const uint32_t other, const uint64_t offset)
+            {
+                return lifetimes_overlap(requests[index], requests[other]) && offset < offsets[other] + memory_requirements[other].byte_size &&
+                       offsets[other] < offset + memory_requirements[index].byte_size;
+            };
+
+            // NOTE: The lowest free offset is either the start of the heap or right behind a texture living at the same time
+            candidates.clear();
+            candidates.push_back(0);
+            for (const uint32_t other : heap->textures)
+            {
+                if (lifetimes_overlap(requests[index], requests[other]))
+                {
+                    candidates.push_back(align_up(offsets[other] + memory_requirements[other].byte_size, requirements.alignment));
+                }
+            }
+            std::ranges::sort(candidates);
+
+            const auto offset = std::ranges::find_if(
+                candidates,
+                [&heap, &overlaps](const uint64_t candidate)
+                {
+                    return std::ranges::none_of(
+                        heap->textures,
+                        [&overlaps, candidate](const uint32_t other)
+                        {
+                            return overlaps(other, candidate);
+                        });
+                });
+            HE_ASSERT(offset != candidates.end());
+
+            offsets[index] = *offset;
+
+            heap->memory_type_bits &= requirements.memory_type_bits;
+            heap->alignment = std::max(heap->alignment, requirements.alignment);
+            heap->byte_size = std::max(heap->byte_size, *offset + requirements.byte_size);
+            heap->textures.push_back(index);
+        }
+
+        uint64_t heap_bytes = 0;
+        for (size_t heap_index = 0; heap_index < heaps.size(); ++heap_index)
+        {
+            const HeapPlacement &placement = heaps[heap_index];
+            const RefPtr<TextureHeap> heap = GraphicsDevice::get()->create_texture_heap({
+                .label = fmt::format("Transient Heap {}", heap_index),
+                .byte_size = placement.byte_size,
+                .alignment = placement.alignment,
+                .memory_type_bits = placement.memory_type_bits,
+            });
+
+            for (const uint32_t index : placement.textures)
+            {
+                m_textures[index].texture = GraphicsDevice::get()->create_texture(requests[index].descriptor, heap, offsets[index]);
+                m_textures[index].texture_view = TransientResourceAllocator::create_texture_view(m_textures[index].texture);
+
+                for (const uint32_t other : placement.textures)
+                {
+                    const bool memory_overlap = offsets[index] < offsets[other] + memory_requirements[other].byte_size &&
+                                                offsets[other] < offsets[index] + memory_requirements[index].byte_size;
+                    if (other != index && memory_overlap && requests[other].last_level < requests[index].first_level)
+                    {
+                        m_textures[index].aliased_textures.push_back(other);
+                    }
+                }
+            }
+
+            heap_bytes += placement.byte_size;
+            m_heaps.push_back(heap);
+        }
+
+        heap_bytes_gauge.set(static_cast<int64_t>(heap_bytes));
+        aliased_bytes_gauge.set(static_cast<int64_t>(requested_bytes - heap_bytes));
+    }
+
+    RefPtr<TextureView> TransientResourceAllocator::create_texture_view(const RefPtr<Texture> &texture)
+    {
+        return GraphicsDevice::get()->create_texture_view({
+            .label = std::string(texture->label()),
+            .texture = texture,
+            .subresource_range =
+                {
+                    .base_mip_level = 0,
+                    .mip_level_count = texture->mip_levels(),
+                    .base_array_level = 0,
+                    .array_layer_count = texture->array_size(),
+                },
+            .component_mapping =
+                {
+                    .r = ComponentSwizzle::Identity,
+                    .g = ComponentSwizzle::Identity,
+                    .b = ComponentSwizzle::Identity,
+                    .a = ComponentSwizzle::Identity,
+                },
+        });
+    }
+} // namespace hyper_engine
\ No newline at end of file
@@ -30,9 +30,10 @@ namespace hyper_engine
         AllGraphics = 1 << 8,
         AllTransfer = 1 << 9,
         AllCommands = 1 << 10,
+        DrawIndirect = 1 << 11,
     };
 
-    enum class BarrierAccess : uint8_t
+    enum class BarrierAccess : uint16_t
     {
         None = 0,
         ShaderRead = 1 << 0,
@@ -43,6 +44,7 @@ namespace hyper_engine
         DepthStencilAttachmentWrite = 1 << 5,
         TransferRead = 1 << 6,
         TransferWrite = 1 << 7,
+        IndirectCommandRead = 1 << 8,
     };
 
     struct MemoryBarrier
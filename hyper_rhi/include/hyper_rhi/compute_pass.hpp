@@ -28,11 +28,10 @@ namespace hyper_engine
 
         // FIXME: This should be RefPtr
         virtual void set_pipeline(const RefPtr<ComputePipeline> &pipeline) = 0;
-        virtual void set_push_constants(const void *data, size_t data_size) const = 0;
+        virtual void set_push_constants(const void *data, size_t data_size) = 0;
 
         virtual void dispatch(uint32_t x, uint32_t y, uint32_t z) const = 0;
-
-        // FIXME: Add indirect
+        virtual void dispatch_indirect(const RefPtr<Buffer> &buffer, uint64_t offset) const = 0;
 
         std::string_view label() const;
         LabelColor label_color() const;
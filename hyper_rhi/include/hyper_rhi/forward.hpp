@@ -44,6 +44,9 @@ namespace hyper_engine
     struct TextureDescriptor;
     class Texture;
 
+    struct TextureHeapDescriptor;
+    class TextureHeap;
+
     struct TextureViewDescriptor;
     class TextureView;
 
@@ -9,7 +9,9 @@
 #include <hyper_core/ref_ptr.hpp>
 
 #include "hyper_rhi/forward.hpp"
+#include "hyper_rhi/memory_statistics.hpp"
 #include "hyper_rhi/resource_handle.hpp"
+#include "hyper_rhi/texture_heap.hpp"
 
 namespace hyper_engine
 {
@@ -35,6 +37,8 @@ namespace hyper_engine
     public:
         static constexpr size_t s_frame_count = 2;
         static constexpr size_t s_descriptor_limit = 1000 * 1000;
+        static constexpr uint32_t s_memory_snapshot_interval = 120;
+        static constexpr float s_memory_budget_warning_threshold = 0.9f;
 
     public:
         virtual ~GraphicsDevice() = default;
@@ -56,9 +60,14 @@ namespace hyper_engine
         RefPtr<Sampler> create_sampler(const SamplerDescriptor &descriptor);
         RefPtr<Sampler> create_sampler(const SamplerDescriptor &descriptor, ResourceHandle handle);
         RefPtr<Texture> create_texture(const TextureDescriptor &descriptor) const;
+        // NOTE: Places the texture at the offset of the heap instead of allocating memory for it
+        RefPtr<Texture> create_texture(const TextureDescriptor &descriptor, const RefPtr<TextureHeap> &heap, uint64_t offset) const;
+        RefPtr<TextureHeap> create_texture_heap(const TextureHeapDescriptor &descriptor) const;
         RefPtr<TextureView> create_texture_view(const TextureViewDescriptor &descriptor);
         RefPtr<TextureView> create_texture_view(const TextureViewDescriptor &descriptor, ResourceHandle handle);
 
+        TextureMemoryRequirements texture_memory_requirements(const TextureDescriptor &descriptor) const;
+
         virtual void begin_frame(RefPtr<Surface> &surface, uint32_t frame_index) = 0;
         virtual void end_frame() const = 0;
         virtual void execute(const RefPtr<CommandList> &command_list) = 0;
@@ -70,6 +79,12 @@ namespace hyper_engine
         virtual bool debug_validation() const = 0;
         virtual bool debug_label() const = 0;
         virtual bool debug_marker() const = 0;
+        // NOTE: Indirect count draws, multi draw indirect and the draw parameters in shaders, which the GPU driven path needs
+        virtual bool indirect_draw_supported() const = 0;
+
+        // NOTE: Returns the snapshot taken every s_memory_snapshot_interval frames
+        virtual const MemoryStatistics &memory_statistics() const = 0;
+        virtual MemoryStatistics query_memory_statistics() const = 0;
 
         static GraphicsDevice *&get();
 
@@ -83,6 +98,12 @@ namespace hyper_engine
 
         virtual RefPtr<Sampler> create_sampler_platform(const SamplerDescriptor &descriptor, ResourceHandle handle) const = 0;
         virtual RefPtr<Texture> create_texture_platform(const TextureDescriptor &descriptor) const = 0;
+        virtual RefPtr<Texture> create_placed_texture_platform(
+            const TextureDescriptor &descriptor,
+            const RefPtr<TextureHeap> &heap,
+            uint64_t offset) const = 0;
+        virtual RefPtr<TextureHeap> create_texture_heap_platform(const TextureHeapDescriptor &descriptor) const = 0;
+        virtual TextureMemoryRequirements texture_memory_requirements_platform(const TextureDescriptor &descriptor) const = 0;
         virtual RefPtr<TextureView> create_texture_view_platform(const TextureViewDescriptor &descriptor, ResourceHandle handle) const = 0;
 
     protected:
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace hyper_engine
+{
+    enum class MemoryCategory : uint8_t
+    {
+        Buffer,
+        Texture,
+        Staging,
+        Count,
+    };
+
+    struct MemoryHeapStatistics
+    {
+        uint64_t budget = 0;
+        uint64_t usage = 0;
+        uint32_t block_count = 0;
+        uint64_t block_bytes = 0;
+        uint32_t allocation_count = 0;
+        uint64_t allocation_bytes = 0;
+        uint64_t largest_unused_range = 0;
+        bool device_local = false;
+    };
+
+    struct MemoryCategoryStatistics
+    {
+        uint32_t allocation_count = 0;
+        uint64_t allocation_bytes = 0;
+        uint32_t allocations_created = 0;
+        uint32_t allocations_destroyed = 0;
+    };
+
+    struct MemoryStatistics
+    {
+        uint64_t frame_index = 0;
+        std::vector<MemoryHeapStatistics> heaps;
+        std::array<MemoryCategoryStatistics, static_cast<size_t>(MemoryCategory::Count)> categories = {};
+
+        // NOTE: Fraction of the allocated block memory which is not used by any allocation
+        float fragmentation = 0.0f;
+    };
+} // namespace hyper_engine
\ No newline at end of file
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace hyper_engine
+{
+    struct PushConstantRange
+    {
+        uint32_t offset = 0;
+        uint32_t size = 0;
+    };
+
+    // NOTE: Shadow copy of the push constants recorded into a pass, so only the bytes that changed since the last push are uploaded
+    class PushConstantState
+    {
+    public:
+        // NOTE: The minimum push constant size every Vulkan implementation has to support
+        static constexpr size_t s_max_size = 128;
+        static constexpr size_t s_word_size = 4;
+
+    public:
+        // NOTE: Returns the word aligned range covering every changed byte, the range is empty if nothing changed
+        PushConstantRange update(const void *data, size_t data_size);
+
+        // NOTE: Has to be called whenever the bound pipeline layout changes, as the previously pushed values become undefined
+        void reset();
+
+    private:
+        std::array<uint8_t, s_max_size> m_data = {};
+        size_t m_size = 0;
+    };
+} // namespace hyper_engine
\ No newline at end of file
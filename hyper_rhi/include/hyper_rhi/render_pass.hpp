@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -29,6 +30,12 @@ namespace hyper_engine
         DontCare,
     };
 
+    enum class IndexFormat : uint8_t
+    {
+        Uint16,
+        Uint32,
+    };
+
     struct Operations
     {
         LoadOperation load_operation = LoadOperation::Clear;
@@ -54,6 +61,8 @@ namespace hyper_engine
         LabelColor label_color;
         std::vector<ColorAttachment> color_attachments;
         DepthStencilAttachment depth_stencil_attachment;
+        // NOTE: Passes with secondaries can't record commands themselves, everything goes through begin_secondary
+        uint32_t secondary_count = 0;
     };
 
     class RenderPass
@@ -63,9 +72,9 @@ namespace hyper_engine
 
         // FIXME: This should be RefPtr
         virtual void set_pipeline(const RefPtr<RenderPipeline> &pipeline) = 0;
-        virtual void set_push_constants(const void *data, size_t data_size) const = 0;
+        virtual void set_push_constants(const void *data, size_t data_size) = 0;
 
-        virtual void set_index_buffer(const RefPtr<Buffer> &buffer) const = 0;
+        virtual void set_index_buffer(const RefPtr<Buffer> &buffer, IndexFormat format) = 0;
 
         virtual void set_scissor(int32_t x, int32_t y, uint32_t width, uint32_t height) const = 0;
         virtual void set_viewport(float x, float y, float width, float height, float min_depth, float max_depth) const = 0;
@@ -75,20 +84,36 @@ namespace hyper_engine
             draw_indexed(uint32_t index_count, uint32_t instance_count, uint32_t first_index, int32_t vertex_offset, uint32_t first_instance)
                 const = 0;
 
-        // FIXME: Add indirect
+        // NOTE: The indirect buffers store tightly packed DrawIndexedIndirectCommand entries
+        virtual void draw_indexed_indirect(const RefPtr<Buffer> &buffer, uint64_t offset, uint32_t draw_count, uint32_t stride) const = 0;
+        virtual void draw_indexed_indirect_count(
+            const RefPtr<Buffer> &buffer,
+            uint64_t offset,
+            const RefPtr<Buffer> &count_buffer,
+            uint64_t count_offset,
+            uint32_t max_draw_count,
+            uint32_t stride) const = 0;
+
+        // NOTE: Records a part of the pass into a secondary command list, which may happen on any thread. The secondaries are executed
+        //       in the order of their indices once the pass ends, so they have to be released before the pass itself.
+        RefPtr<RenderPass> begin_secondary(uint32_t index);
 
         std::string_view label() const;
         LabelColor label_color() const;
         const std::vector<ColorAttachment> &color_attachments() const;
         DepthStencilAttachment depth_stencil_attachment() const;
+        uint32_t secondary_count() const;
 
     protected:
         explicit RenderPass(const RenderPassDescriptor &descriptor);
 
+        virtual RefPtr<RenderPass> begin_secondary_platform(uint32_t index) = 0;
+
     protected:
         std::string m_label;
         LabelColor m_label_color;
         std::vector<ColorAttachment> m_color_attachments;
         DepthStencilAttachment m_depth_stencil_attachment;
+        uint32_t m_secondary_count = 0;
     };
 } // namespace hyper_engine
\ No newline at end of file
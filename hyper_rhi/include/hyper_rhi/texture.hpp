@@ -21,6 +21,8 @@ namespace hyper_engine
         Storage = 1 << 0,
         RenderAttachment = 1 << 1,
         ShaderResource = 1 << 2,
+        // NOTE: The contents never leave the render pass, which allows lazily allocated memory on tile based GPUs
+        Transient = 1 << 3,
     };
 
     struct TextureDescriptor
@@ -34,6 +36,8 @@ namespace hyper_engine
         Format format = Format::Unknown;
         Dimension dimension = Dimension::Unknown;
         BitFlags<TextureUsage> usage = TextureUsage::None;
+
+        bool operator==(const TextureDescriptor &other) const = default;
     };
 
     class Texture
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace hyper_engine
+{
+    struct TextureMemoryRequirements
+    {
+        uint64_t byte_size = 0;
+        uint64_t alignment = 1;
+        // NOTE: Textures can only share a heap if their memory type bits overlap
+        uint32_t memory_type_bits = 0;
+    };
+
+    struct TextureHeapDescriptor
+    {
+        std::string label;
+        uint64_t byte_size = 0;
+        uint64_t alignment = 1;
+        uint32_t memory_type_bits = 0;
+    };
+
+    // NOTE: A block of device memory, textures placed at overlapping ranges alias each other and mustn't be used at the same time
+    class TextureHeap
+    {
+    public:
+        virtual ~TextureHeap() = default;
+
+        std::string_view label() const;
+        uint64_t byte_size() const;
+
+    protected:
+        explicit TextureHeap(const TextureHeapDescriptor &descriptor);
+
+    protected:
+        std::string m_label;
+        uint64_t m_byte_size = 0;
+    };
+} // namespace hyper_engine
\ No newline at end of file
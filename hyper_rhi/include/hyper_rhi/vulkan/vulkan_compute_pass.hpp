@@ -9,6 +9,7 @@
 #include <hyper_core/ref_ptr.hpp>
 
 #include "hyper_rhi/compute_pass.hpp"
+#include "hyper_rhi/push_constant_state.hpp"
 #include "hyper_rhi/vulkan/vulkan_common.hpp"
 
 namespace hyper_engine
@@ -22,15 +23,19 @@ namespace hyper_engine
         ~VulkanComputePass() override;
 
         void set_pipeline(const RefPtr<ComputePipeline> &pipeline) override;
-        void set_push_constants(const void *data, size_t data_size) const override;
+        void set_push_constants(const void *data, size_t data_size) override;
 
         void dispatch(uint32_t x, uint32_t y, uint32_t z) const override;
+        void dispatch_indirect(const RefPtr<Buffer> &buffer, uint64_t offset) const override;
 
         VkCommandBuffer command_buffer() const;
 
     private:
         VkCommandBuffer m_command_buffer = VK_NULL_HANDLE;
 
+        // NOTE: Shadow state of the recorded binds, used to skip commands that wouldn't change anything
         RefPtr<ComputePipeline> m_pipeline;
+        VkPipelineLayout m_pipeline_layout = VK_NULL_HANDLE;
+        PushConstantState m_push_constants;
     };
 } // namespace hyper_engine
\ No newline at end of file
@@ -8,6 +8,7 @@
 
 #include <array>
 #include <optional>
+#include <thread>
 #include <vector>
 
 #include "hyper_rhi/label_color.hpp"
@@ -53,6 +54,8 @@ namespace hyper_engine
     {
         VkImage image = VK_NULL_HANDLE;
         VmaAllocation allocation = VK_NULL_HANDLE;
+        // NOTE: Placed textures only own their image, the memory belongs to the heap
+        bool placed = false;
     };
 
     struct TextureViewEntry
@@ -70,13 +73,23 @@ namespace hyper_engine
         std::vector<VkSampler> samplers;
         std::vector<VkShaderModule> shader_modules;
         std::vector<TextureEntry> textures;
+        std::vector<VmaAllocation> texture_heaps;
         std::vector<TextureViewEntry> texture_views;
     };
 
+    // NOTE: Command pools can't be used by multiple threads at once, so every thread records its secondaries from its own pool
+    struct ThreadCommandPool
+    {
+        VkCommandPool command_pool = VK_NULL_HANDLE;
+        std::vector<VkCommandBuffer> secondary_command_buffers;
+        uint32_t used_secondary_count = 0;
+    };
+
     struct FrameData
     {
         VkCommandPool command_pool;
         VkCommandBuffer command_buffer;
+        std::vector<ThreadCommandPool> thread_command_pools;
 
         VkFence render_fence;
         VkSemaphore submit_semaphore;
@@ -103,6 +116,12 @@ namespace hyper_engine
         RefPtr<Sampler> create_sampler_platform(const SamplerDescriptor &descriptor, ResourceHandle handle) const override;
         RefPtr<Texture> create_texture_platform(const TextureDescriptor &descriptor) const override;
         RefPtr<Texture> create_texture_internal(const TextureDescriptor &descriptor, VkImage image) const;
+        RefPtr<Texture> create_placed_texture_platform(
+            const TextureDescriptor &descriptor,
+            const RefPtr<TextureHeap> &heap,
+            uint64_t offset) const override;
+        RefPtr<TextureHeap> create_texture_heap_platform(const TextureHeapDescriptor &descriptor) const override;
+        TextureMemoryRequirements texture_memory_requirements_platform(const TextureDescriptor &descriptor) const override;
         RefPtr<TextureView> create_texture_view_platform(const TextureViewDescriptor &descriptor, ResourceHandle handle) const override;
 
         void begin_marker(VkCommandBuffer command_buffer, MarkerType type, std::string_view name, LabelColor color) const;
@@ -111,6 +130,9 @@ namespace hyper_engine
         void set_object_name(const void *handle, ObjectType type, std::string_view name) const;
         void destroy_resources();
 
+        // NOTE: Thread safe, as long as every thread calling this has its own job system thread index
+        VkCommandBuffer allocate_secondary_command_buffer();
+
         void begin_frame(RefPtr<Surface> &surface, uint32_t frame_index) override;
         void end_frame() const override;
         void execute(const RefPtr<CommandList> &command_list) override;
@@ -122,6 +144,13 @@ namespace hyper_engine
         bool debug_validation() const override;
         bool debug_label() const override;
         bool debug_marker() const override;
+        bool indirect_draw_supported() const override;
+
+        const MemoryStatistics &memory_statistics() const override;
+        MemoryStatistics query_memory_statistics() const override;
+
+        void track_allocation(VmaAllocation allocation, MemoryCategory category) const;
+        void untrack_allocation(VmaAllocation allocation) const;
 
         DescriptorManager &descriptor_manager() override;
 
@@ -144,9 +173,14 @@ namespace hyper_engine
         void create_device();
         void create_allocator();
         void create_frames();
+        void reset_thread_command_pools();
+        void update_memory_statistics();
+        void record_memory_usage() const;
 
         static bool check_validation_layer_support();
         static bool check_extension_support(const VkPhysicalDevice &physical_device);
+        static bool check_memory_budget_support(const VkPhysicalDevice &physical_device);
+        static bool check_indirect_draw_support(const VkPhysicalDevice &physical_device);
         static bool check_feature_support(const VkPhysicalDevice &physical_device);
 
         static VKAPI_ATTR VkBool32 VKAPI_CALL debug_callback(
@@ -167,14 +201,22 @@ namespace hyper_engine
         VkDevice m_device = VK_NULL_HANDLE;
         uint32_t m_queue_family = 0;
         VkQueue m_queue = VK_NULL_HANDLE;
+        bool m_memory_budget_supported = false;
+        bool m_indirect_draw_supported = false;
         VmaAllocator m_allocator = VK_NULL_HANDLE;
 
         // NOTE: Using raw pointer to guarantee order of destruction
         VulkanDescriptorManager *m_descriptor_manager = nullptr;
 
+        // NOTE: Secondaries recorded outside of the job system share the pools of worker 0 with the render thread
+        std::thread::id m_render_thread_id;
+
         uint32_t m_current_frame_index = 0;
         std::array<FrameData, GraphicsDevice::s_frame_count> m_frames;
 
         ResourceQueue m_resource_queue;
+
+        mutable std::array<MemoryCategoryStatistics, static_cast<size_t>(MemoryCategory::Count)> m_memory_categories;
+        MemoryStatistics m_memory_statistics;
     };
 } // namespace hyper_engine
@@ -6,8 +6,11 @@
 
 #pragma once
 
+#include <vector>
+
 #include <hyper_core/ref_ptr.hpp>
 
+#include "hyper_rhi/push_constant_state.hpp"
 #include "hyper_rhi/render_pass.hpp"
 #include "hyper_rhi/vulkan/vulkan_common.hpp"
 
@@ -18,13 +21,13 @@ namespace hyper_engine
     class VulkanRenderPass final : public RenderPass
     {
     public:
-        VulkanRenderPass(const RenderPassDescriptor &descriptor, VkCommandBuffer command_buffer);
+        VulkanRenderPass(const RenderPassDescriptor &descriptor, VkCommandBuffer command_buffer, VkCommandBufferLevel level);
         ~VulkanRenderPass() override;
 
         void set_pipeline(const RefPtr<RenderPipeline> &pipeline) override;
-        void set_push_constants(const void *data, size_t data_size) const override;
+        void set_push_constants(const void *data, size_t data_size) override;
 
-        void set_index_buffer(const RefPtr<Buffer> &buffer) const override;
+        void set_index_buffer(const RefPtr<Buffer> &buffer, IndexFormat format) override;
 
         void set_scissor(int32_t x, int32_t y, uint32_t width, uint32_t height) const override;
         void set_viewport(float x, float y, float width, float height, float min_depth, float max_depth) const override;
@@ -33,14 +36,41 @@ namespace hyper_engine
         void draw_indexed(uint32_t index_count, uint32_t instance_count, uint32_t first_index, int32_t vertex_offset, uint32_t first_instance)
             const override;
 
+        void draw_indexed_indirect(const RefPtr<Buffer> &buffer, uint64_t offset, uint32_t draw_count, uint32_t stride) const override;
+        void draw_indexed_indirect_count(
+            const RefPtr<Buffer> &buffer,
+            uint64_t offset,
+            const RefPtr<Buffer> &count_buffer,
+            uint64_t count_offset,
+            uint32_t max_draw_count,
+            uint32_t stride) const override;
+
         VkCommandBuffer command_buffer() const;
 
+        RefPtr<RenderPass> begin_secondary_platform(uint32_t index) override;
+
         static VkAttachmentLoadOp get_attachment_load_operation(LoadOperation load_operation);
         static VkAttachmentStoreOp get_attachment_store_operation(StoreOperation store_operation);
+        static VkIndexType get_index_type(IndexFormat format);
+
+    private:
+        VkExtent2D render_area_extent() const;
+
+        void begin_rendering() const;
+        void begin_secondary_command_buffer() const;
 
     private:
         VkCommandBuffer m_command_buffer = VK_NULL_HANDLE;
+        VkCommandBufferLevel m_level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+
+        // NOTE: Filled by the threads recording the secondaries, every one of them only writes its own index
+        std::vector<VkCommandBuffer> m_secondary_command_buffers;
 
+        // NOTE: Shadow state of the recorded binds, used to skip commands that wouldn't change anything
         RefPtr<RenderPipeline> m_pipeline;
+        VkPipelineLayout m_pipeline_layout = VK_NULL_HANDLE;
+        RefPtr<Buffer> m_index_buffer;
+        IndexFormat m_index_format = IndexFormat::Uint32;
+        PushConstantState m_push_constants;
     };
 } // namespace hyper_engine
\ No newline at end of file
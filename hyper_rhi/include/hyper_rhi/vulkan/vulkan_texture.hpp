@@ -6,7 +6,10 @@
 
 #pragma once
 
+#include <hyper_core/ref_ptr.hpp>
+
 #include "hyper_rhi/texture.hpp"
+#include "hyper_rhi/texture_heap.hpp"
 #include "hyper_rhi/vulkan/vulkan_common.hpp"
 
 #include <vk_mem_alloc.h>
@@ -16,7 +19,8 @@ namespace hyper_engine
     class VulkanTexture final : public Texture
     {
     public:
-        VulkanTexture(const TextureDescriptor &descriptor, VkImage image, VmaAllocation allocation);
+        // NOTE: Placed textures have no allocation of their own and reference the heap they live in instead
+        VulkanTexture(const TextureDescriptor &descriptor, VkImage image, VmaAllocation allocation, RefPtr<TextureHeap> heap);
         ~VulkanTexture() override;
 
         VkImage image() const;
@@ -30,5 +34,7 @@ namespace hyper_engine
     private:
         VkImage m_image = VK_NULL_HANDLE;
         VmaAllocation m_allocation = VK_NULL_HANDLE;
+        // NOTE: Keeps the heap alive, so its memory is freed after the image
+        RefPtr<TextureHeap> m_heap = nullptr;
     };
 } // namespace hyper_engine
\ No newline at end of file
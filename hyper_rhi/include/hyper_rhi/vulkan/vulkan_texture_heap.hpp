@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hyper_rhi/texture_heap.hpp"
+#include "hyper_rhi/vulkan/vulkan_common.hpp"
+
+#include <vk_mem_alloc.h>
+
+namespace hyper_engine
+{
+    class VulkanTextureHeap final : public TextureHeap
+    {
+    public:
+        VulkanTextureHeap(const TextureHeapDescriptor &descriptor, VmaAllocation allocation);
+        ~VulkanTextureHeap() override;
+
+        VmaAllocation allocation() const;
+
+    private:
+        VmaAllocation m_allocation = VK_NULL_HANDLE;
+    };
+} // namespace hyper_engine
\ No newline at end of file
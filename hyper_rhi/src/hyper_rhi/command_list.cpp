@@ -7,6 +7,7 @@
 #include "hyper_rhi/command_list.hpp"
 
 #include <hyper_core/assertion.hpp>
+#include <hyper_core/flight_recorder.hpp>
 
 #include "hyper_rhi/compute_pass.hpp"
 #include "hyper_rhi/render_pass.hpp"
@@ -15,6 +16,8 @@ namespace hyper_engine
 {
     RefPtr<ComputePass> CommandList::begin_compute_pass(const ComputePassDescriptor &descriptor) const
     {
+        FlightRecorder::get()->record_pass(descriptor.label);
+
         return begin_compute_pass_platform(descriptor);
     }
 
@@ -27,6 +30,8 @@ namespace hyper_engine
             HE_ASSERT(color_attachment.view);
         }
 
+        FlightRecorder::get()->record_pass(descriptor.label);
+
         return begin_render_pass_platform(descriptor);
     }
 } // namespace hyper_engine
\ No newline at end of file
@@ -7,6 +7,8 @@
 #include "hyper_rhi/graphics_device.hpp"
 
 #include <hyper_core/assertion.hpp>
+#include <hyper_core/flight_recorder.hpp>
+#include <hyper_core/metrics.hpp>
 
 #if HE_WINDOWS
 // #    include "hyper_rhi/d3d12/d3d12_graphics_device.hpp"
@@ -25,6 +27,28 @@
 
 namespace hyper_engine
 {
+    static void count_created_resource()
+    {
+        static Counter &created_counter = MetricsRegistry::get()->counter("rhi.resources_created");
+        created_counter.add();
+
+        FlightRecorder::get()->record_resources_created(1);
+    }
+
+    static void validate_texture_descriptor(const TextureDescriptor &descriptor)
+    {
+        HE_ASSERT(descriptor.width > 0);
+        HE_ASSERT(descriptor.height > 0);
+        HE_ASSERT(descriptor.depth > 0);
+        HE_ASSERT(descriptor.array_size > 0);
+        HE_ASSERT(descriptor.mip_levels > 0);
+        HE_ASSERT(descriptor.format != Format::Unknown);
+        HE_ASSERT(descriptor.dimension != Dimension::Unknown);
+        HE_ASSERT(descriptor.usage != TextureUsage::None);
+
+        // FIXME: Add check that sampled and storage image can't be used simultaneously (exclusive)
+    }
+
     GraphicsDevice *GraphicsDevice::create(const GraphicsDeviceDescriptor &descriptor)
     {
         switch (descriptor.graphics_api)
@@ -69,6 +93,8 @@ namespace hyper_engine
             HE_ASSERT(descriptor.usage & BufferUsage::Storage);
         }
 
+        count_created_resource();
+
         const RefPtr<Buffer> buffer = create_buffer_platform(descriptor, handle);
 
         // FIXME: Could this be written cleaner?
@@ -85,6 +111,8 @@ namespace hyper_engine
         HE_ASSERT(descriptor.layout);
         HE_ASSERT(descriptor.shader);
 
+        count_created_resource();
+
         return create_compute_pipeline_platform(descriptor);
     }
 
@@ -105,6 +133,8 @@ namespace hyper_engine
             HE_ASSERT(descriptor.depth_stencil_state.depth_format != Format::Unknown);
         }
 
+        count_created_resource();
+
         return create_render_pipeline_platform(descriptor);
     }
 
@@ -112,6 +142,8 @@ namespace hyper_engine
     {
         HE_ASSERT((descriptor.push_constant_size % 4) == 0);
 
+        count_created_resource();
+
         return create_pipeline_layout_platform(descriptor);
     }
 
@@ -121,6 +153,8 @@ namespace hyper_engine
         HE_ASSERT(!descriptor.entry_name.empty());
         HE_ASSERT(!descriptor.bytes.empty());
 
+        count_created_resource();
+
         return create_shader_module_platform(descriptor);
     }
 
@@ -135,6 +169,8 @@ namespace hyper_engine
     {
         // FIXME: Add assertions
 
+        count_created_resource();
+
         const RefPtr<Sampler> sampler = create_sampler_platform(descriptor, handle);
 
         // FIXME: Could this be written cleaner?
@@ -145,20 +181,49 @@ namespace hyper_engine
 
     RefPtr<Texture> GraphicsDevice::create_texture(const TextureDescriptor &descriptor) const
     {
-        HE_ASSERT(descriptor.width > 0);
-        HE_ASSERT(descriptor.height > 0);
-        HE_ASSERT(descriptor.depth > 0);
-        HE_ASSERT(descriptor.array_size > 0);
-        HE_ASSERT(descriptor.mip_levels > 0);
-        HE_ASSERT(descriptor.format != Format::Unknown);
-        HE_ASSERT(descriptor.dimension != Dimension::Unknown);
-        HE_ASSERT(descriptor.usage != TextureUsage::None);
+        validate_texture_descriptor(descriptor);
 
-        // FIXME: Add check that sampled and storage image can't be used simultaneously (exclusive)
+        count_created_resource();
 
         return create_texture_platform(descriptor);
     }
 
+    RefPtr<Texture> GraphicsDevice::create_texture(
+        const TextureDescriptor &descriptor,
+        const RefPtr<TextureHeap> &heap,
+        const uint64_t offset) const
+    {
+        validate_texture_descriptor(descriptor);
+        HE_ASSERT(heap);
+        HE_ASSERT(!(descriptor.usage & TextureUsage::Transient), "Transient textures are lazily allocated and can't be placed");
+
+        const TextureMemoryRequirements memory_requirements = texture_memory_requirements(descriptor);
+        HE_ASSERT(offset % memory_requirements.alignment == 0);
+        HE_ASSERT(offset + memory_requirements.byte_size <= heap->byte_size());
+
+        count_created_resource();
+
+        return create_placed_texture_platform(descriptor, heap, offset);
+    }
+
+    RefPtr<TextureHeap> GraphicsDevice::create_texture_heap(const TextureHeapDescriptor &descriptor) const
+    {
+        HE_ASSERT(descriptor.byte_size > 0);
+        HE_ASSERT(descriptor.alignment > 0);
+        HE_ASSERT(descriptor.memory_type_bits != 0);
+
+        count_created_resource();
+
+        return create_texture_heap_platform(descriptor);
+    }
+
+    TextureMemoryRequirements GraphicsDevice::texture_memory_requirements(const TextureDescriptor &descriptor) const
+    {
+        validate_texture_descriptor(descriptor);
+
+        return texture_memory_requirements_platform(descriptor);
+    }
+
     RefPtr<TextureView> GraphicsDevice::create_texture_view(const TextureViewDescriptor &descriptor)
     {
         ResourceHandle handle;
@@ -176,6 +241,8 @@ namespace hyper_engine
         HE_ASSERT(descriptor.subresource_range.mip_level_count > 0);
         HE_ASSERT(descriptor.subresource_range.array_layer_count > 0);
 
+        count_created_resource();
+
         const RefPtr<TextureView> texture_view = create_texture_view_platform(descriptor, handle);
 
         // FIXME: Could this be written cleaner?
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/push_constant_state.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include <hyper_core/assertion.hpp>
+
+namespace hyper_engine
+{
+    PushConstantRange PushConstantState::update(const void *data, const size_t data_size)
+    {
+        HE_ASSERT(data_size <= s_max_size);
+        HE_ASSERT(data_size % s_word_size == 0);
+
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+
+        size_t begin = data_size;
+        size_t end = 0;
+        for (size_t offset = 0; offset < data_size; offset += s_word_size)
+        {
+            // NOTE: Bytes past the previously pushed size were never uploaded and always count as changed
+            if (offset >= m_size || std::memcmp(m_data.data() + offset, bytes + offset, s_word_size) != 0)
+            {
+                begin = std::min(begin, offset);
+                end = offset + s_word_size;
+            }
+        }
+
+        if (begin >= end)
+        {
+            return {};
+        }
+
+        std::memcpy(m_data.data() + begin, bytes + begin, end - begin);
+        m_size = std::max(m_size, end);
+
+        return {
+            .offset = static_cast<uint32_t>(begin),
+            .size = static_cast<uint32_t>(end - begin),
+        };
+    }
+
+    void PushConstantState::reset()
+    {
+        m_size = 0;
+    }
+} // namespace hyper_engine
\ No newline at end of file
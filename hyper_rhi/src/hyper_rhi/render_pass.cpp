@@ -6,6 +6,8 @@
 
 #include "hyper_rhi/render_pass.hpp"
 
+#include <hyper_core/assertion.hpp>
+
 #include "hyper_rhi/texture_view.hpp"
 
 namespace hyper_engine
@@ -15,7 +17,15 @@ namespace hyper_engine
         , m_label_color(descriptor.label_color)
         , m_color_attachments(descriptor.color_attachments)
         , m_depth_stencil_attachment(descriptor.depth_stencil_attachment)
+        , m_secondary_count(descriptor.secondary_count)
+    {
+    }
+
+    RefPtr<RenderPass> RenderPass::begin_secondary(const uint32_t index)
     {
+        HE_ASSERT(index < m_secondary_count);
+
+        return begin_secondary_platform(index);
     }
 
     std::string_view RenderPass::label() const
@@ -37,4 +47,9 @@ namespace hyper_engine
     {
         return m_depth_stencil_attachment;
     }
+
+    uint32_t RenderPass::secondary_count() const
+    {
+        return m_secondary_count;
+    }
 } // namespace hyper_engine
\ No newline at end of file
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/texture_heap.hpp"
+
+namespace hyper_engine
+{
+    TextureHeap::TextureHeap(const TextureHeapDescriptor &descriptor)
+        : m_label(descriptor.label)
+        , m_byte_size(descriptor.byte_size)
+    {
+    }
+
+    std::string_view TextureHeap::label() const
+    {
+        return m_label;
+    }
+
+    uint64_t TextureHeap::byte_size() const
+    {
+        return m_byte_size;
+    }
+} // namespace hyper_engine
\ No newline at end of file
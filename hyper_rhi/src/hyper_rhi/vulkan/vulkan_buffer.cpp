@@ -7,6 +7,8 @@
 #include "hyper_rhi/vulkan/vulkan_buffer.hpp"
 
 #include <hyper_core/assertion.hpp>
+#include <hyper_core/flight_recorder.hpp>
+#include <hyper_core/metrics.hpp>
 
 #include "hyper_rhi/vulkan/vulkan_descriptor_manager.hpp"
 #include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
@@ -67,6 +69,17 @@ namespace hyper_engine
         HE_ASSERT(buffer != VK_NULL_HANDLE);
         HE_ASSERT(allocation != VK_NULL_HANDLE);
 
+        track_allocation(allocation, staging ? MemoryCategory::Staging : MemoryCategory::Buffer);
+
+        // NOTE: Staging buffers don't go through GraphicsDevice::create_buffer, so they are counted here
+        if (staging)
+        {
+            static Counter &created_counter = MetricsRegistry::get()->counter("rhi.resources_created");
+            created_counter.add();
+
+            FlightRecorder::get()->record_resources_created(1);
+        }
+
         set_object_name(buffer, ObjectType::Buffer, descriptor.label);
 
         return make_ref<VulkanBuffer>(descriptor, handle, buffer, allocation);
@@ -8,6 +8,7 @@
 
 #include <hyper_core/assertion.hpp>
 #include <hyper_core/logger.hpp>
+#include <hyper_core/metrics.hpp>
 
 #include "hyper_rhi/vulkan/vulkan_buffer.hpp"
 #include "hyper_rhi/vulkan/vulkan_compute_pass.hpp"
@@ -151,6 +152,9 @@ namespace hyper_engine
         };
 
         vkCmdPipelineBarrier2(m_command_buffer, &dependency_info);
+
+        static Counter &barrier_counter = MetricsRegistry::get()->counter("rhi.barriers");
+        barrier_counter.add(memory_barriers.size() + buffer_memory_barriers.size() + image_memory_barriers.size());
     }
 
     void VulkanCommandList::clear_buffer(const RefPtr<Buffer> &buffer, const size_t size, const uint64_t offset)
@@ -524,6 +528,9 @@ namespace hyper_engine
             memcpy(mapped_ptr, data, size);
             vmaUnmapMemory(graphics_device->allocator(), vulkan_staging_buffer.allocation());
 
+            static Counter &staging_counter = MetricsRegistry::get()->counter("rhi.staging_bytes");
+            staging_counter.add(size);
+
             const VkBufferCopy2 region = {
                 .sType = VK_STRUCTURE_TYPE_BUFFER_COPY_2,
                 .pNext = nullptr,
@@ -575,6 +582,9 @@ namespace hyper_engine
         memcpy(mapped_ptr, data, data_size);
         vmaUnmapMemory(graphics_device->allocator(), vulkan_staging_buffer.allocation());
 
+        static Counter &staging_counter = MetricsRegistry::get()->counter("rhi.staging_bytes");
+        staging_counter.add(data_size);
+
         const VkImageSubresourceLayers subresource_layers = {
             .aspectMask = VulkanTextureView::get_image_aspect_flags(vulkan_texture.format()),
             .mipLevel = mip_level,
@@ -623,7 +633,7 @@ namespace hyper_engine
 
     RefPtr<RenderPass> VulkanCommandList::begin_render_pass_platform(const RenderPassDescriptor &descriptor) const
     {
-        return make_ref<VulkanRenderPass>(descriptor, m_command_buffer);
+        return make_ref<VulkanRenderPass>(descriptor, m_command_buffer, VK_COMMAND_BUFFER_LEVEL_PRIMARY);
     }
 
     VkCommandBuffer VulkanCommandList::command_buffer() const
@@ -690,6 +700,11 @@ namespace hyper_engine
             pipeline_stage |= VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
         }
 
+        if (barrier_pipeline_stage & BarrierPipelineStage::DrawIndirect)
+        {
+            pipeline_stage |= VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT;
+        }
+
         return pipeline_stage;
     }
 
@@ -737,6 +752,11 @@ namespace hyper_engine
             access |= VK_ACCESS_2_TRANSFER_WRITE_BIT;
         }
 
+        if (barrier_access & BarrierAccess::IndirectCommandRead)
+        {
+            access |= VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT;
+        }
+
         return access;
     }
 
@@ -6,8 +6,11 @@
 
 #include "hyper_rhi/vulkan/vulkan_compute_pass.hpp"
 
+#include <hyper_core/assertion.hpp>
 #include <hyper_core/logger.hpp>
+#include <hyper_core/metrics.hpp>
 
+#include "hyper_rhi/vulkan/vulkan_buffer.hpp"
 #include "hyper_rhi/vulkan/vulkan_compute_pipeline.hpp"
 #include "hyper_rhi/vulkan/vulkan_descriptor_manager.hpp"
 #include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
@@ -31,33 +34,66 @@ namespace hyper_engine
 
     void VulkanComputePass::set_pipeline(const RefPtr<ComputePipeline> &pipeline)
     {
+        static Counter &pipeline_counter = MetricsRegistry::get()->counter("rhi.pipeline_binds");
+        static Counter &filtered_pipeline_counter = MetricsRegistry::get()->counter("rhi.filtered.pipeline_binds");
+        static Counter &filtered_descriptor_set_counter = MetricsRegistry::get()->counter("rhi.filtered.descriptor_set_binds");
+
+        if (pipeline == m_pipeline)
+        {
+            filtered_pipeline_counter.add(1);
+            filtered_descriptor_set_counter.add(1);
+            return;
+        }
+
         m_pipeline = pipeline;
+        pipeline_counter.add(1);
 
         const VulkanComputePipeline &vulkan_pipeline = static_cast<const VulkanComputePipeline &>(*m_pipeline);
         const VulkanPipelineLayout &layout = static_cast<const VulkanPipelineLayout &>(*m_pipeline->layout());
 
-        VulkanGraphicsDevice *graphics_device = static_cast<VulkanGraphicsDevice *>(GraphicsDevice::get());
-        const VulkanDescriptorManager &descriptor_manager = static_cast<VulkanDescriptorManager &>(graphics_device->descriptor_manager());
-        const auto &descriptor_sets = descriptor_manager.descriptor_sets();
+        // NOTE: The bindless sets are the same for every layout, they only have to be rebound if the layout isn't compatible anymore
+        if (layout.pipeline_layout() != m_pipeline_layout)
+        {
+            m_pipeline_layout = layout.pipeline_layout();
+            m_push_constants.reset();
+
+            VulkanGraphicsDevice *graphics_device = static_cast<VulkanGraphicsDevice *>(GraphicsDevice::get());
+            const VulkanDescriptorManager &descriptor_manager = static_cast<VulkanDescriptorManager &>(graphics_device->descriptor_manager());
+            const auto &descriptor_sets = descriptor_manager.descriptor_sets();
 
-        vkCmdBindDescriptorSets(
-            m_command_buffer,
-            VK_PIPELINE_BIND_POINT_COMPUTE,
-            layout.pipeline_layout(),
-            0,
-            static_cast<uint32_t>(descriptor_sets.size()),
-            descriptor_sets.data(),
-            0,
-            nullptr);
+            vkCmdBindDescriptorSets(
+                m_command_buffer,
+                VK_PIPELINE_BIND_POINT_COMPUTE,
+                m_pipeline_layout,
+                0,
+                static_cast<uint32_t>(descriptor_sets.size()),
+                descriptor_sets.data(),
+                0,
+                nullptr);
+        }
+        else
+        {
+            filtered_descriptor_set_counter.add(1);
+        }
 
         vkCmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, vulkan_pipeline.pipeline());
     }
 
-    void VulkanComputePass::set_push_constants(const void *data, const size_t data_size) const
+    void VulkanComputePass::set_push_constants(const void *data, const size_t data_size)
     {
-        const VulkanPipelineLayout &layout = static_cast<const VulkanPipelineLayout &>(*m_pipeline->layout());
+        HE_ASSERT(m_pipeline_layout != VK_NULL_HANDLE);
+
+        static Counter &filtered_push_constant_counter = MetricsRegistry::get()->counter("rhi.filtered.push_constant_bytes");
 
-        vkCmdPushConstants(m_command_buffer, layout.pipeline_layout(), VK_SHADER_STAGE_ALL, 0, static_cast<uint32_t>(data_size), data);
+        const PushConstantRange range = m_push_constants.update(data, data_size);
+        filtered_push_constant_counter.add(data_size - range.size);
+        if (range.size == 0)
+        {
+            return;
+        }
+
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+        vkCmdPushConstants(m_command_buffer, m_pipeline_layout, VK_SHADER_STAGE_ALL, range.offset, range.size, bytes + range.offset);
     }
 
     void VulkanComputePass::dispatch(const uint32_t x, const uint32_t y, const uint32_t z) const
@@ -65,6 +101,13 @@ namespace hyper_engine
         vkCmdDispatch(m_command_buffer, x, y, z);
     }
 
+    void VulkanComputePass::dispatch_indirect(const RefPtr<Buffer> &buffer, const uint64_t offset) const
+    {
+        const VulkanBuffer &vulkan_buffer = static_cast<const VulkanBuffer &>(*buffer);
+
+        vkCmdDispatchIndirect(m_command_buffer, vulkan_buffer.buffer(), offset);
+    }
+
     VkCommandBuffer VulkanComputePass::command_buffer() const
     {
         return m_command_buffer;
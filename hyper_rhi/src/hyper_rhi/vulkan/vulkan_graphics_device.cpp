@@ -6,9 +6,12 @@
 
 #include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cstring>
 #include <map>
 #include <set>
+#include <thread>
 #include <vector>
 
 #include <SDL3/SDL_vulkan.h>
@@ -19,7 +22,10 @@
 #include <vk_mem_alloc.h>
 
 #include <hyper_core/assertion.hpp>
+#include <hyper_core/flight_recorder.hpp>
+#include <hyper_core/job_system.hpp>
 #include <hyper_core/logger.hpp>
+#include <hyper_core/metrics.hpp>
 
 #include "hyper_rhi/vulkan/vulkan_buffer.hpp"
 #include "hyper_rhi/vulkan/vulkan_command_list.hpp"
@@ -47,11 +53,16 @@ namespace hyper_engine
         , m_device(VK_NULL_HANDLE)
         , m_queue_family(0)
         , m_queue(VK_NULL_HANDLE)
+        , m_memory_budget_supported(false)
+        , m_indirect_draw_supported(false)
         , m_allocator(VK_NULL_HANDLE)
         , m_descriptor_manager(nullptr)
+        , m_render_thread_id(std::this_thread::get_id())
         , m_current_frame_index(0)
         , m_frames({})
         , m_resource_queue()
+        , m_memory_categories({})
+        , m_memory_statistics()
     {
         volkInitialize();
 
@@ -97,6 +108,11 @@ namespace hyper_engine
             vkDestroyFence(m_device, frame.render_fence, nullptr);
             vkDestroySemaphore(m_device, frame.submit_semaphore, nullptr);
             vkDestroyCommandPool(m_device, frame.command_pool, nullptr);
+
+            for (const ThreadCommandPool &thread_command_pool : frame.thread_command_pools)
+            {
+                vkDestroyCommandPool(m_device, thread_command_pool.command_pool, nullptr);
+            }
         }
 
         delete m_descriptor_manager;
@@ -231,10 +247,22 @@ namespace hyper_engine
 
     void VulkanGraphicsDevice::destroy_resources()
     {
+        const size_t destroyed_count = m_resource_queue.buffers.size() + m_resource_queue.compute_pipelines.size() +
+                                       m_resource_queue.graphics_pipelines.size() + m_resource_queue.pipeline_layouts.size() +
+                                       m_resource_queue.samplers.size() + m_resource_queue.shader_modules.size() +
+                                       m_resource_queue.textures.size() + m_resource_queue.texture_heaps.size() +
+                                       m_resource_queue.texture_views.size();
+
+        static Counter &destroyed_counter = MetricsRegistry::get()->counter("rhi.resources_destroyed");
+        destroyed_counter.add(destroyed_count);
+
+        FlightRecorder::get()->record_resources_destroyed(static_cast<uint32_t>(destroyed_count));
+
         for (const BufferEntry &buffer_entry : m_resource_queue.buffers)
         {
             if (buffer_entry.allocation != VK_NULL_HANDLE)
             {
+                untrack_allocation(buffer_entry.allocation);
                 vmaDestroyBuffer(m_allocator, buffer_entry.buffer, buffer_entry.allocation);
             }
             m_descriptor_manager->retire_handle(buffer_entry.handle);
@@ -273,13 +301,26 @@ namespace hyper_engine
 
         for (const TextureEntry &texture_entry : m_resource_queue.textures)
         {
-            if (texture_entry.allocation != VK_NULL_HANDLE)
+            if (texture_entry.placed)
+            {
+                vkDestroyImage(m_device, texture_entry.image, nullptr);
+            }
+            else if (texture_entry.allocation != VK_NULL_HANDLE)
             {
+                untrack_allocation(texture_entry.allocation);
                 vmaDestroyImage(m_allocator, texture_entry.image, texture_entry.allocation);
             }
         }
         m_resource_queue.textures.clear();
 
+        // NOTE: Heaps are freed after the textures, as placed textures keep their heap alive
+        for (const VmaAllocation &texture_heap : m_resource_queue.texture_heaps)
+        {
+            untrack_allocation(texture_heap);
+            vmaFreeMemory(m_allocator, texture_heap);
+        }
+        m_resource_queue.texture_heaps.clear();
+
         for (const TextureViewEntry &texture_view_entry : m_resource_queue.texture_views)
         {
             vkDestroyImageView(m_device, texture_view_entry.view, nullptr);
@@ -288,6 +329,40 @@ namespace hyper_engine
         m_resource_queue.texture_views.clear();
     }
 
+    VkCommandBuffer VulkanGraphicsDevice::allocate_secondary_command_buffer()
+    {
+        FrameData &frame = m_frames[m_current_frame_index % GraphicsDevice::s_frame_count];
+
+        const uint32_t thread_index = JobSystem::thread_index();
+        HE_ASSERT(thread_index < frame.thread_command_pools.size());
+        HE_ASSERT(
+            thread_index != 0 || std::this_thread::get_id() == m_render_thread_id,
+            "Only the render thread may record secondaries outside of the job system");
+
+        ThreadCommandPool &thread_command_pool = frame.thread_command_pools[thread_index];
+        if (thread_command_pool.used_secondary_count == thread_command_pool.secondary_command_buffers.size())
+        {
+            const VkCommandBufferAllocateInfo command_buffer_allocate_info = {
+                .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+                .pNext = nullptr,
+                .commandPool = thread_command_pool.command_pool,
+                .level = VK_COMMAND_BUFFER_LEVEL_SECONDARY,
+                .commandBufferCount = 1,
+            };
+
+            VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+            HE_VK_CHECK(vkAllocateCommandBuffers(m_device, &command_buffer_allocate_info, &command_buffer));
+            HE_ASSERT(command_buffer != VK_NULL_HANDLE);
+
+            thread_command_pool.secondary_command_buffers.push_back(command_buffer);
+        }
+
+        const VkCommandBuffer command_buffer = thread_command_pool.secondary_command_buffers[thread_command_pool.used_secondary_count];
+        thread_command_pool.used_secondary_count += 1;
+
+        return command_buffer;
+    }
+
     void VulkanGraphicsDevice::begin_frame(RefPtr<Surface> &surface, const uint32_t frame_index)
     {
         VulkanSurface &vulkan_surface = static_cast<VulkanSurface &>(*surface);
@@ -305,7 +380,18 @@ namespace hyper_engine
         };
         HE_VK_CHECK(vkWaitSemaphores(m_device, &semaphore_wait_info, std::numeric_limits<uint64_t>::max()));
 
+        // NOTE: VMA only fetches new budgets from the memory budget extension when the frame index changes
+        vmaSetCurrentFrameIndex(m_allocator, frame_index);
+
         destroy_resources();
+        reset_thread_command_pools();
+
+        if (m_current_frame_index % GraphicsDevice::s_memory_snapshot_interval == 0)
+        {
+            update_memory_statistics();
+        }
+
+        record_memory_usage();
 
         if (vulkan_surface.resized())
         {
@@ -423,6 +509,98 @@ namespace hyper_engine
         return m_debug_marker;
     }
 
+    bool VulkanGraphicsDevice::indirect_draw_supported() const
+    {
+        return m_indirect_draw_supported;
+    }
+
+    const MemoryStatistics &VulkanGraphicsDevice::memory_statistics() const
+    {
+        return m_memory_statistics;
+    }
+
+    MemoryStatistics VulkanGraphicsDevice::query_memory_statistics() const
+    {
+        const VkPhysicalDeviceMemoryProperties *memory_properties = nullptr;
+        vmaGetMemoryProperties(m_allocator, &memory_properties);
+
+        std::array<VmaBudget, VK_MAX_MEMORY_HEAPS> budgets = {};
+        vmaGetHeapBudgets(m_allocator, budgets.data());
+
+        VmaTotalStatistics total_statistics = {};
+        vmaCalculateStatistics(m_allocator, &total_statistics);
+
+        MemoryStatistics memory_statistics = {};
+        memory_statistics.frame_index = m_current_frame_index;
+        memory_statistics.heaps.reserve(memory_properties->memoryHeapCount);
+        for (uint32_t index = 0; index < memory_properties->memoryHeapCount; ++index)
+        {
+            const VmaBudget &budget = budgets[index];
+            const VmaDetailedStatistics &heap_statistics = total_statistics.memoryHeap[index];
+
+            memory_statistics.heaps.push_back({
+                .budget = budget.budget,
+                .usage = budget.usage,
+                .block_count = heap_statistics.statistics.blockCount,
+                .block_bytes = heap_statistics.statistics.blockBytes,
+                .allocation_count = heap_statistics.statistics.allocationCount,
+                .allocation_bytes = heap_statistics.statistics.allocationBytes,
+                .largest_unused_range = heap_statistics.unusedRangeCount > 0 ? heap_statistics.unusedRangeSizeMax : 0,
+                .device_local = (memory_properties->memoryHeaps[index].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0,
+            });
+        }
+
+        memory_statistics.categories = m_memory_categories;
+
+        const VmaStatistics &statistics = total_statistics.total.statistics;
+        if (statistics.blockBytes > 0)
+        {
+            const uint64_t unused_bytes = statistics.blockBytes - statistics.allocationBytes;
+            memory_statistics.fragmentation = static_cast<float>(unused_bytes) / static_cast<float>(statistics.blockBytes);
+        }
+
+        return memory_statistics;
+    }
+
+    void VulkanGraphicsDevice::track_allocation(const VmaAllocation allocation, const MemoryCategory category) const
+    {
+        HE_ASSERT(allocation != VK_NULL_HANDLE);
+        HE_ASSERT(category != MemoryCategory::Count);
+
+        MemoryCategoryStatistics &category_statistics = m_memory_categories[static_cast<size_t>(category)];
+
+        // NOTE: The category is stored inside the allocation, so it can be resolved again on destruction
+        vmaSetAllocationUserData(m_allocator, allocation, &category_statistics);
+
+        VmaAllocationInfo allocation_info = {};
+        vmaGetAllocationInfo(m_allocator, allocation, &allocation_info);
+
+        category_statistics.allocation_count += 1;
+        category_statistics.allocation_bytes += allocation_info.size;
+        category_statistics.allocations_created += 1;
+    }
+
+    void VulkanGraphicsDevice::untrack_allocation(const VmaAllocation allocation) const
+    {
+        HE_ASSERT(allocation != VK_NULL_HANDLE);
+
+        VmaAllocationInfo allocation_info = {};
+        vmaGetAllocationInfo(m_allocator, allocation, &allocation_info);
+
+        MemoryCategoryStatistics *category_statistics = static_cast<MemoryCategoryStatistics *>(allocation_info.pUserData);
+        if (category_statistics == nullptr)
+        {
+            return;
+        }
+
+        HE_ASSERT(category_statistics->allocation_count > 0);
+        HE_ASSERT(category_statistics->allocation_bytes >= allocation_info.size);
+
+        category_statistics->allocation_count -= 1;
+        category_statistics->allocation_bytes -= allocation_info.size;
+        category_statistics->allocations_destroyed += 1;
+    }
+
     DescriptorManager &VulkanGraphicsDevice::descriptor_manager()
     {
         return *static_cast<DescriptorManager *>(m_descriptor_manager);
@@ -679,9 +857,22 @@ namespace hyper_engine
 
     void VulkanGraphicsDevice::create_device()
     {
+        // NOTE: Only the GPU driven path needs the indirect draw features, devices without them can still render on the CPU path
+        m_indirect_draw_supported = VulkanGraphicsDevice::check_indirect_draw_support(m_physical_device);
+        if (!m_indirect_draw_supported)
+        {
+            HE_WARN("Indirect count draws are not supported, the GPU driven path is unavailable");
+        }
+
+        VkPhysicalDeviceShaderDrawParametersFeatures shader_draw_parameters = {
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES,
+            .pNext = nullptr,
+            .shaderDrawParameters = m_indirect_draw_supported ? VK_TRUE : VK_FALSE,
+        };
+
         VkPhysicalDeviceDynamicRenderingFeatures dynamic_rendering = {
             .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES,
-            .pNext = nullptr,
+            .pNext = &shader_draw_parameters,
             .dynamicRendering = VK_TRUE,
         };
 
@@ -727,6 +918,8 @@ namespace hyper_engine
             .pNext = &descriptor_indexing,
             .features = {},
         };
+        device_features.features.multiDrawIndirect = m_indirect_draw_supported ? VK_TRUE : VK_FALSE;
+        device_features.features.drawIndirectFirstInstance = m_indirect_draw_supported ? VK_TRUE : VK_FALSE;
 
         size_t feature_count = 0;
         const auto *current = static_cast<const VkBaseInStructure *>(device_features.pNext);
@@ -751,6 +944,22 @@ namespace hyper_engine
         const uint32_t layer_count = m_debug_validation ? static_cast<uint32_t>(g_validation_layers.size()) : 0;
         const char *const *layers = m_debug_validation ? g_validation_layers.data() : nullptr;
 
+        std::vector<const char *> extensions(g_device_extensions.begin(), g_device_extensions.end());
+        if (m_indirect_draw_supported)
+        {
+            extensions.push_back(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+        }
+
+        m_memory_budget_supported = VulkanGraphicsDevice::check_memory_budget_support(m_physical_device);
+        if (m_memory_budget_supported)
+        {
+            extensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+        }
+        else
+        {
+            HE_WARN("Memory budget extension is not supported, falling back to estimated heap budgets");
+        }
+
         const VkDeviceCreateInfo device_create_info = {
             .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
             .pNext = &device_features,
@@ -759,8 +968,8 @@ namespace hyper_engine
             .pQueueCreateInfos = &queue_create_info,
             .enabledLayerCount = layer_count,
             .ppEnabledLayerNames = layers,
-            .enabledExtensionCount = static_cast<uint32_t>(g_device_extensions.size()),
-            .ppEnabledExtensionNames = g_device_extensions.data(),
+            .enabledExtensionCount = static_cast<uint32_t>(extensions.size()),
+            .ppEnabledExtensionNames = extensions.data(),
             .pEnabledFeatures = nullptr,
         };
 
@@ -810,8 +1019,14 @@ namespace hyper_engine
             .vkGetDeviceImageMemoryRequirements = vkGetDeviceImageMemoryRequirements,
         };
 
+        VmaAllocatorCreateFlags allocator_flags = 0;
+        if (m_memory_budget_supported)
+        {
+            allocator_flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+        }
+
         const VmaAllocatorCreateInfo allocator_create_info = {
-            .flags = 0,
+            .flags = allocator_flags,
             .physicalDevice = m_physical_device,
             .device = m_device,
             .preferredLargeHeapBlockSize = 0,
@@ -883,6 +1098,90 @@ namespace hyper_engine
             HE_ASSERT(m_frames[index].submit_semaphore != VK_NULL_HANDLE);
 
             set_object_name(m_frames[index].submit_semaphore, ObjectType::Semaphore, fmt::format("Frame Submit #{}", index));
+
+            // NOTE: The secondaries are recorded once per frame, so the pools are reset as a whole instead of every command buffer
+            m_frames[index].thread_command_pools.resize(JobSystem::get()->thread_count());
+            for (size_t thread_index = 0; thread_index < m_frames[index].thread_command_pools.size(); ++thread_index)
+            {
+                ThreadCommandPool &thread_command_pool = m_frames[index].thread_command_pools[thread_index];
+
+                const VkCommandPoolCreateInfo thread_command_pool_create_info = {
+                    .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+                    .pNext = nullptr,
+                    .flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+                    .queueFamilyIndex = m_queue_family,
+                };
+
+                HE_VK_CHECK(vkCreateCommandPool(m_device, &thread_command_pool_create_info, nullptr, &thread_command_pool.command_pool));
+                HE_ASSERT(thread_command_pool.command_pool != VK_NULL_HANDLE);
+
+                set_object_name(
+                    thread_command_pool.command_pool,
+                    ObjectType::CommandPool,
+                    fmt::format("Frame #{} Thread #{}", index, thread_index));
+            }
+        }
+    }
+
+    void VulkanGraphicsDevice::reset_thread_command_pools()
+    {
+        FrameData &frame = m_frames[m_current_frame_index % GraphicsDevice::s_frame_count];
+        for (ThreadCommandPool &thread_command_pool : frame.thread_command_pools)
+        {
+            if (thread_command_pool.used_secondary_count == 0)
+            {
+                continue;
+            }
+
+            HE_VK_CHECK(vkResetCommandPool(m_device, thread_command_pool.command_pool, 0));
+            thread_command_pool.used_secondary_count = 0;
+        }
+    }
+
+    void VulkanGraphicsDevice::record_memory_usage() const
+    {
+        const VkPhysicalDeviceMemoryProperties *memory_properties = nullptr;
+        vmaGetMemoryProperties(m_allocator, &memory_properties);
+
+        std::array<VmaBudget, VK_MAX_MEMORY_HEAPS> budgets = {};
+        vmaGetHeapBudgets(m_allocator, budgets.data());
+
+        uint64_t usage = 0;
+        uint64_t budget = 0;
+        for (uint32_t index = 0; index < memory_properties->memoryHeapCount; ++index)
+        {
+            if (memory_properties->memoryHeaps[index].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+            {
+                usage += budgets[index].usage;
+                budget += budgets[index].budget;
+            }
+        }
+
+        FlightRecorder::get()->record_memory(usage, budget);
+    }
+
+    void VulkanGraphicsDevice::update_memory_statistics()
+    {
+        m_memory_statistics = query_memory_statistics();
+
+        for (size_t index = 0; index < m_memory_statistics.heaps.size(); ++index)
+        {
+            const MemoryHeapStatistics &heap = m_memory_statistics.heaps[index];
+            if (heap.budget == 0)
+            {
+                continue;
+            }
+
+            const float budget_usage = static_cast<float>(heap.usage) / static_cast<float>(heap.budget);
+            if (budget_usage >= GraphicsDevice::s_memory_budget_warning_threshold)
+            {
+                HE_WARN(
+                    "Memory heap #{} is nearing its budget: {:.1f} MiB / {:.1f} MiB ({:.0f}%)",
+                    index,
+                    static_cast<double>(heap.usage) / (1024.0 * 1024.0),
+                    static_cast<double>(heap.budget) / (1024.0 * 1024.0),
+                    budget_usage * 100.0f);
+            }
         }
     }
 
@@ -933,6 +1232,61 @@ namespace hyper_engine
         return required_extensions.empty();
     }
 
+    bool VulkanGraphicsDevice::check_memory_budget_support(const VkPhysicalDevice &physical_device)
+    {
+        uint32_t extension_count = 0;
+        HE_VK_CHECK(vkEnumerateDeviceExtensionProperties(physical_device, nullptr, &extension_count, nullptr));
+
+        std::vector<VkExtensionProperties> extensions(extension_count);
+        HE_VK_CHECK(vkEnumerateDeviceExtensionProperties(physical_device, nullptr, &extension_count, extensions.data()));
+
+        for (const VkExtensionProperties &extension : extensions)
+        {
+            if (std::strcmp(extension.extensionName, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME) == 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool VulkanGraphicsDevice::check_indirect_draw_support(const VkPhysicalDevice &physical_device)
+    {
+        uint32_t extension_count = 0;
+        HE_VK_CHECK(vkEnumerateDeviceExtensionProperties(physical_device, nullptr, &extension_count, nullptr));
+
+        std::vector<VkExtensionProperties> extensions(extension_count);
+        HE_VK_CHECK(vkEnumerateDeviceExtensionProperties(physical_device, nullptr, &extension_count, extensions.data()));
+
+        const bool draw_indirect_count_supported = std::ranges::any_of(
+            extensions,
+            [](const VkExtensionProperties &extension)
+            {
+                return std::strcmp(extension.extensionName, VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME) == 0;
+            });
+        if (!draw_indirect_count_supported)
+        {
+            return false;
+        }
+
+        VkPhysicalDeviceShaderDrawParametersFeatures shader_draw_parameters = {
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES,
+            .pNext = nullptr,
+            .shaderDrawParameters = VK_FALSE,
+        };
+
+        VkPhysicalDeviceFeatures2 device_features = {
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+            .pNext = &shader_draw_parameters,
+            .features = {},
+        };
+        vkGetPhysicalDeviceFeatures2(physical_device, &device_features);
+
+        return device_features.features.multiDrawIndirect && device_features.features.drawIndirectFirstInstance &&
+               shader_draw_parameters.shaderDrawParameters;
+    }
+
     bool VulkanGraphicsDevice::check_feature_support(const VkPhysicalDevice &physical_device)
     {
         VkPhysicalDeviceDynamicRenderingFeatures dynamic_rendering = {
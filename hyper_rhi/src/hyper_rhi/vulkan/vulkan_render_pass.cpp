@@ -8,6 +8,7 @@
 
 #include <hyper_core/assertion.hpp>
 #include <hyper_core/logger.hpp>
+#include <hyper_core/metrics.hpp>
 #include <hyper_core/ref_ptr.hpp>
 
 #include "hyper_rhi/vulkan/vulkan_buffer.hpp"
@@ -20,127 +21,77 @@
 
 namespace hyper_engine
 {
-    VulkanRenderPass::VulkanRenderPass(const RenderPassDescriptor &descriptor, const VkCommandBuffer command_buffer)
+    VulkanRenderPass::VulkanRenderPass(
+        const RenderPassDescriptor &descriptor,
+        const VkCommandBuffer command_buffer,
+        const VkCommandBufferLevel level)
         : RenderPass(descriptor)
         , m_command_buffer(command_buffer)
+        , m_level(level)
+        , m_secondary_command_buffers(descriptor.secondary_count, VK_NULL_HANDLE)
     {
-        VulkanGraphicsDevice *graphics_device = static_cast<VulkanGraphicsDevice *>(GraphicsDevice::get());
-        graphics_device->begin_marker(m_command_buffer, MarkerType::RenderPass, m_label, m_label_color);
-
-        // FIXME: Should this always use the first image?
-        const VkExtent2D render_area_extent = {
-            .width = m_color_attachments[0].view->texture()->width(),
-            .height = m_color_attachments[0].view->texture()->height(),
-        };
-
-        constexpr VkOffset2D render_area_offset = {
-            .x = 0,
-            .y = 0,
-        };
-
-        const VkRect2D render_area = {
-            .offset = render_area_offset,
-            .extent = render_area_extent,
-        };
-
-        constexpr VkClearValue clear_value = {
-            .color =
-                {
-                    .float32 =
-                        {
-                            0.0f,
-                            0.0f,
-                            0.0f,
-                            1.0f,
-                        },
-                },
-        };
-
-        std::vector<VkRenderingAttachmentInfo> color_attachments = {};
-        for (const ColorAttachment &color_attachment : m_color_attachments)
+        if (m_level == VK_COMMAND_BUFFER_LEVEL_SECONDARY)
         {
-            const VulkanTextureView &color_attachment_view = static_cast<const VulkanTextureView &>(*color_attachment.view);
-
-            const VkRenderingAttachmentInfo color_attachment_info = {
-                .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
-                .pNext = nullptr,
-                .imageView = color_attachment_view.image_view(),
-                .imageLayout = VK_IMAGE_LAYOUT_ATTACHMENT_OPTIMAL,
-                .resolveMode = VK_RESOLVE_MODE_NONE,
-                .resolveImageView = VK_NULL_HANDLE,
-                .resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED,
-                .loadOp = VulkanRenderPass::get_attachment_load_operation(color_attachment.operation.load_operation),
-                .storeOp = VulkanRenderPass::get_attachment_store_operation(color_attachment.operation.store_operation),
-                .clearValue = clear_value,
-            };
-
-            color_attachments.push_back(color_attachment_info);
+            begin_secondary_command_buffer();
         }
+        else
+        {
+            VulkanGraphicsDevice *graphics_device = static_cast<VulkanGraphicsDevice *>(GraphicsDevice::get());
+            graphics_device->begin_marker(m_command_buffer, MarkerType::RenderPass, m_label, m_label_color);
 
-        constexpr VkClearValue depth_clear_value = {
-            .depthStencil =
-                {
-                    .depth = 1.0,
-                    .stencil = 0,
-                },
-        };
-
-        const VkImageView depth_attachment_view = m_depth_stencil_attachment.view == nullptr
-                                                      ? VK_NULL_HANDLE
-                                                      : static_cast<const VulkanTextureView &>(*m_depth_stencil_attachment.view).image_view();
-
-        const VkRenderingAttachmentInfo depth_attachment_info = {
-            .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
-            .pNext = nullptr,
-            .imageView = depth_attachment_view,
-            .imageLayout = VK_IMAGE_LAYOUT_ATTACHMENT_OPTIMAL,
-            .resolveMode = VK_RESOLVE_MODE_NONE,
-            .resolveImageView = VK_NULL_HANDLE,
-            .resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED,
-            .loadOp = VulkanRenderPass::get_attachment_load_operation(m_depth_stencil_attachment.depth_operation.load_operation),
-            .storeOp = VulkanRenderPass::get_attachment_store_operation(m_depth_stencil_attachment.depth_operation.store_operation),
-            .clearValue = depth_clear_value,
-        };
-
-        const VkRenderingInfo rendering_info = {
-            .sType = VK_STRUCTURE_TYPE_RENDERING_INFO,
-            .pNext = nullptr,
-            .flags = 0,
-            .renderArea = render_area,
-            .layerCount = 1,
-            .viewMask = 0,
-            .colorAttachmentCount = static_cast<uint32_t>(color_attachments.size()),
-            .pColorAttachments = color_attachments.data(),
-            .pDepthAttachment = depth_attachment_view == nullptr ? nullptr : &depth_attachment_info,
-            .pStencilAttachment = nullptr,
-        };
+            begin_rendering();
+        }
 
-        const VkViewport viewport = {
-            .x = 0.0,
-            .y = 0,
-            .width = static_cast<float>(render_area_extent.width),
-            .height = static_cast<float>(render_area_extent.height),
-            .minDepth = 0.0,
-            .maxDepth = 1.0,
-        };
+        // NOTE: Passes executing secondaries can't record any state, the secondaries set it themselves
+        if (m_secondary_command_buffers.empty())
+        {
+            const VkExtent2D render_area_extent = VulkanRenderPass::render_area_extent();
+
+            const VkViewport viewport = {
+                .x = 0.0,
+                .y = 0,
+                .width = static_cast<float>(render_area_extent.width),
+                .height = static_cast<float>(render_area_extent.height),
+                .minDepth = 0.0,
+                .maxDepth = 1.0,
+            };
 
-        constexpr VkOffset2D offset = {
-            .x = 0,
-            .y = 0,
-        };
+            constexpr VkOffset2D offset = {
+                .x = 0,
+                .y = 0,
+            };
 
-        const VkRect2D scissor = {
-            .offset = offset,
-            .extent = render_area_extent,
-        };
+            const VkRect2D scissor = {
+                .offset = offset,
+                .extent = render_area_extent,
+            };
 
-        vkCmdBeginRendering(m_command_buffer, &rendering_info);
-        vkCmdSetViewport(m_command_buffer, 0, 1, &viewport);
-        vkCmdSetScissor(m_command_buffer, 0, 1, &scissor);
+            vkCmdSetViewport(m_command_buffer, 0, 1, &viewport);
+            vkCmdSetScissor(m_command_buffer, 0, 1, &scissor);
+        }
     }
 
     VulkanRenderPass::~VulkanRenderPass()
     {
+        if (m_level == VK_COMMAND_BUFFER_LEVEL_SECONDARY)
+        {
+            HE_VK_CHECK(vkEndCommandBuffer(m_command_buffer));
+            return;
+        }
+
+        if (!m_secondary_command_buffers.empty())
+        {
+            // NOTE: Indices without a recorded secondary are skipped, the order of the others is kept
+            std::erase(m_secondary_command_buffers, VK_NULL_HANDLE);
+            if (!m_secondary_command_buffers.empty())
+            {
+                vkCmdExecuteCommands(
+                    m_command_buffer,
+                    static_cast<uint32_t>(m_secondary_command_buffers.size()),
+                    m_secondary_command_buffers.data());
+            }
+        }
+
         vkCmdEndRendering(m_command_buffer);
 
         VulkanGraphicsDevice *graphics_device = static_cast<VulkanGraphicsDevice *>(GraphicsDevice::get());
@@ -149,33 +100,67 @@ namespace hyper_engine
 
     void VulkanRenderPass::set_pipeline(const RefPtr<RenderPipeline> &pipeline)
     {
+        static Counter &pipeline_counter = MetricsRegistry::get()->counter("rhi.pipeline_binds");
+        static Counter &filtered_pipeline_counter = MetricsRegistry::get()->counter("rhi.filtered.pipeline_binds");
+        static Counter &filtered_descriptor_set_counter = MetricsRegistry::get()->counter("rhi.filtered.descriptor_set_binds");
+
+        if (pipeline == m_pipeline)
+        {
+            filtered_pipeline_counter.add(1);
+            filtered_descriptor_set_counter.add(1);
+            return;
+        }
+
         m_pipeline = pipeline;
+        pipeline_counter.add(1);
 
         const VulkanRenderPipeline &vulkan_pipeline = static_cast<const VulkanRenderPipeline &>(*m_pipeline);
         const VulkanPipelineLayout &layout = static_cast<const VulkanPipelineLayout &>(*m_pipeline->layout());
 
-        VulkanGraphicsDevice *graphics_device = static_cast<VulkanGraphicsDevice *>(GraphicsDevice::get());
-        const VulkanDescriptorManager &descriptor_manager = static_cast<VulkanDescriptorManager &>(graphics_device->descriptor_manager());
-        const auto &descriptor_sets = descriptor_manager.descriptor_sets();
-
-        vkCmdBindDescriptorSets(
-            m_command_buffer,
-            VK_PIPELINE_BIND_POINT_GRAPHICS,
-            layout.pipeline_layout(),
-            0,
-            static_cast<uint32_t>(descriptor_sets.size()),
-            descriptor_sets.data(),
-            0,
-            nullptr);
+        // NOTE: The bindless sets are the same for every layout, they only have to be rebound if the layout isn't compatible anymore
+        if (layout.pipeline_layout() != m_pipeline_layout)
+        {
+            m_pipeline_layout = layout.pipeline_layout();
+            m_push_constants.reset();
+
+            VulkanGraphicsDevice *graphics_device = static_cast<VulkanGraphicsDevice *>(GraphicsDevice::get());
+            const VulkanDescriptorManager &descriptor_manager = static_cast<VulkanDescriptorManager &>(graphics_device->descriptor_manager());
+            const auto &descriptor_sets = descriptor_manager.descriptor_sets();
+
+            vkCmdBindDescriptorSets(
+                m_command_buffer,
+                VK_PIPELINE_BIND_POINT_GRAPHICS,
+                m_pipeline_layout,
+                0,
+                static_cast<uint32_t>(descriptor_sets.size()),
+                descriptor_sets.data(),
+                0,
+                nullptr);
+        }
+        else
+        {
+            filtered_descriptor_set_counter.add(1);
+        }
 
         vkCmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vulkan_pipeline.pipeline());
     }
 
-    void VulkanRenderPass::set_index_buffer(const RefPtr<Buffer> &buffer) const
+    void VulkanRenderPass::set_index_buffer(const RefPtr<Buffer> &buffer, const IndexFormat format)
     {
+        static Counter &filtered_index_buffer_counter = MetricsRegistry::get()->counter("rhi.filtered.index_buffer_binds");
+
+        if (buffer == m_index_buffer && format == m_index_format)
+        {
+            filtered_index_buffer_counter.add(1);
+            return;
+        }
+
+        m_index_buffer = buffer;
+        m_index_format = format;
+
         const VulkanBuffer &vulkan_buffer = static_cast<const VulkanBuffer &>(*buffer);
 
-        vkCmdBindIndexBuffer(m_command_buffer, vulkan_buffer.buffer(), 0, VK_INDEX_TYPE_UINT32);
+        vkCmdBindIndexBuffer(m_command_buffer, vulkan_buffer.buffer(), 0, VulkanRenderPass::get_index_type(format));
     }
 
     void VulkanRenderPass::set_scissor(const int32_t x, const int32_t y, const uint32_t width, const uint32_t height) const
@@ -218,11 +203,21 @@ namespace hyper_engine
         vkCmdSetViewport(m_command_buffer, 0, 1, &viewport);
     }
 
-    void VulkanRenderPass::set_push_constants(const void *data, const size_t data_size) const
+    void VulkanRenderPass::set_push_constants(const void *data, const size_t data_size)
     {
-        const VulkanPipelineLayout &layout = static_cast<const VulkanPipelineLayout &>(*m_pipeline->layout());
+        HE_ASSERT(m_pipeline_layout != VK_NULL_HANDLE);
+
+        static Counter &filtered_push_constant_counter = MetricsRegistry::get()->counter("rhi.filtered.push_constant_bytes");
+
+        const PushConstantRange range = m_push_constants.update(data, data_size);
+        filtered_push_constant_counter.add(data_size - range.size);
+        if (range.size == 0)
+        {
+            return;
+        }
 
-        vkCmdPushConstants(m_command_buffer, layout.pipeline_layout(), VK_SHADER_STAGE_ALL, 0, static_cast<uint32_t>(data_size), data);
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+        vkCmdPushConstants(m_command_buffer, m_pipeline_layout, VK_SHADER_STAGE_ALL, range.offset, range.size, bytes + range.offset);
     }
 
     void VulkanRenderPass::draw(
@@ -244,11 +239,64 @@ namespace hyper_engine
         vkCmdDrawIndexed(m_command_buffer, index_count, instance_count, first_index, vertex_offset, first_instance);
     }
 
+    void VulkanRenderPass::draw_indexed_indirect(
+        const RefPtr<Buffer> &buffer,
+        const uint64_t offset,
+        const uint32_t draw_count,
+        const uint32_t stride) const
+    {
+        const VulkanBuffer &vulkan_buffer = static_cast<const VulkanBuffer &>(*buffer);
+
+        vkCmdDrawIndexedIndirect(m_command_buffer, vulkan_buffer.buffer(), offset, draw_count, stride);
+    }
+
+    void VulkanRenderPass::draw_indexed_indirect_count(
+        const RefPtr<Buffer> &buffer,
+        const uint64_t offset,
+        const RefPtr<Buffer> &count_buffer,
+        const uint64_t count_offset,
+        const uint32_t max_draw_count,
+        const uint32_t stride) const
+    {
+        const VulkanBuffer &vulkan_buffer = static_cast<const VulkanBuffer &>(*buffer);
+        const VulkanBuffer &vulkan_count_buffer = static_cast<const VulkanBuffer &>(*count_buffer);
+
+        vkCmdDrawIndexedIndirectCount(
+            m_command_buffer,
+            vulkan_buffer.buffer(),
+            offset,
+            vulkan_count_buffer.buffer(),
+            count_offset,
+            max_draw_count,
+            stride);
+    }
+
     VkCommandBuffer VulkanRenderPass::command_buffer() const
     {
         return m_command_buffer;
     }
 
+    RefPtr<RenderPass> VulkanRenderPass::begin_secondary_platform(const uint32_t index)
+    {
+        HE_ASSERT(m_level == VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+
+        VulkanGraphicsDevice *graphics_device = static_cast<VulkanGraphicsDevice *>(GraphicsDevice::get());
+
+        const VkCommandBuffer command_buffer = graphics_device->allocate_secondary_command_buffer();
+        m_secondary_command_buffers[index] = command_buffer;
+
+        return make_ref<VulkanRenderPass>(
+            RenderPassDescriptor{
+                .label = m_label,
+                .label_color = m_label_color,
+                .color_attachments = m_color_attachments,
+                .depth_stencil_attachment = m_depth_stencil_attachment,
+                .secondary_count = 0,
+            },
+            command_buffer,
+            VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    }
+
     VkAttachmentLoadOp VulkanRenderPass::get_attachment_load_operation(const LoadOperation load_operation)
     {
         switch (load_operation)
@@ -276,4 +324,163 @@ namespace hyper_engine
             HE_UNREACHABLE();
         }
     }
+
+    VkIndexType VulkanRenderPass::get_index_type(const IndexFormat format)
+    {
+        switch (format)
+        {
+        case IndexFormat::Uint16:
+            return VK_INDEX_TYPE_UINT16;
+        case IndexFormat::Uint32:
+            return VK_INDEX_TYPE_UINT32;
+        default:
+            HE_UNREACHABLE();
+        }
+    }
+
+    VkExtent2D VulkanRenderPass::render_area_extent() const
+    {
+        // FIXME: Should this always use the first image?
+        return {
+            .width = m_color_attachments[0].view->texture()->width(),
+            .height = m_color_attachments[0].view->texture()->height(),
+        };
+    }
+
+    void VulkanRenderPass::begin_rendering() const
+    {
+        const VkExtent2D render_area_extent = VulkanRenderPass::render_area_extent();
+
+        constexpr VkOffset2D render_area_offset = {
+            .x = 0,
+            .y = 0,
+        };
+
+        const VkRect2D render_area = {
+            .offset = render_area_offset,
+            .extent = render_area_extent,
+        };
+
+        constexpr VkClearValue clear_value = {
+            .color =
+                {
+                    .float32 =
+                        {
+                            0.0f,
+                            0.0f,
+                            0.0f,
+                            1.0f,
+                        },
+                },
+        };
+
+        std::vector<VkRenderingAttachmentInfo> color_attachments = {};
+        for (const ColorAttachment &color_attachment : m_color_attachments)
+        {
+            const VulkanTextureView &color_attachment_view = static_cast<const VulkanTextureView &>(*color_attachment.view);
+
+            const VkRenderingAttachmentInfo color_attachment_info = {
+                .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+                .pNext = nullptr,
+                .imageView = color_attachment_view.image_view(),
+                .imageLayout = VK_IMAGE_LAYOUT_ATTACHMENT_OPTIMAL,
+                .resolveMode = VK_RESOLVE_MODE_NONE,
+                .resolveImageView = VK_NULL_HANDLE,
+                .resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+                .loadOp = VulkanRenderPass::get_attachment_load_operation(color_attachment.operation.load_operation),
+                .storeOp = VulkanRenderPass::get_attachment_store_operation(color_attachment.operation.store_operation),
+                .clearValue = clear_value,
+            };
+
+            color_attachments.push_back(color_attachment_info);
+        }
+
+        constexpr VkClearValue depth_clear_value = {
+            .depthStencil =
+                {
+                    .depth = 1.0,
+                    .stencil = 0,
+                },
+        };
+
+        const VkImageView depth_attachment_view = m_depth_stencil_attachment.view == nullptr
+                                                      ? VK_NULL_HANDLE
+                                                      : static_cast<const VulkanTextureView &>(*m_depth_stencil_attachment.view).image_view();
+
+        const VkRenderingAttachmentInfo depth_attachment_info = {
+            .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+            .pNext = nullptr,
+            .imageView = depth_attachment_view,
+            .imageLayout = VK_IMAGE_LAYOUT_ATTACHMENT_OPTIMAL,
+            .resolveMode = VK_RESOLVE_MODE_NONE,
+            .resolveImageView = VK_NULL_HANDLE,
+            .resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+            .loadOp = VulkanRenderPass::get_attachment_load_operation(m_depth_stencil_attachment.depth_operation.load_operation),
+            .storeOp = VulkanRenderPass::get_attachment_store_operation(m_depth_stencil_attachment.depth_operation.store_operation),
+            .clearValue = depth_clear_value,
+        };
+
+        const VkRenderingFlags rendering_flags =
+            m_secondary_command_buffers.empty() ? 0 : static_cast<VkRenderingFlags>(VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT);
+
+        const VkRenderingInfo rendering_info = {
+            .sType = VK_STRUCTURE_TYPE_RENDERING_INFO,
+            .pNext = nullptr,
+            .flags = rendering_flags,
+            .renderArea = render_area,
+            .layerCount = 1,
+            .viewMask = 0,
+            .colorAttachmentCount = static_cast<uint32_t>(color_attachments.size()),
+            .pColorAttachments = color_attachments.data(),
+            .pDepthAttachment = depth_attachment_view == nullptr ? nullptr : &depth_attachment_info,
+            .pStencilAttachment = nullptr,
+        };
+
+        vkCmdBeginRendering(m_command_buffer, &rendering_info);
+    }
+
+    void VulkanRenderPass::begin_secondary_command_buffer() const
+    {
+        std::vector<VkFormat> color_attachment_formats;
+        for (const ColorAttachment &color_attachment : m_color_attachments)
+        {
+            color_attachment_formats.push_back(VulkanTexture::get_format(color_attachment.view->texture()->format()));
+        }
+
+        const VkFormat depth_attachment_format = m_depth_stencil_attachment.view == nullptr
+                                                     ? VK_FORMAT_UNDEFINED
+                                                     : VulkanTexture::get_format(m_depth_stencil_attachment.view->texture()->format());
+
+        const VkCommandBufferInheritanceRenderingInfo inheritance_rendering_info = {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .viewMask = 0,
+            .colorAttachmentCount = static_cast<uint32_t>(color_attachment_formats.size()),
+            .pColorAttachmentFormats = color_attachment_formats.data(),
+            .depthAttachmentFormat = depth_attachment_format,
+            .stencilAttachmentFormat = VK_FORMAT_UNDEFINED,
+            .rasterizationSamples = VK_SAMPLE_COUNT_1_BIT,
+        };
+
+        const VkCommandBufferInheritanceInfo inheritance_info = {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+            .pNext = &inheritance_rendering_info,
+            .renderPass = VK_NULL_HANDLE,
+            .subpass = 0,
+            .framebuffer = VK_NULL_HANDLE,
+            .occlusionQueryEnable = VK_FALSE,
+            .queryFlags = 0,
+            .pipelineStatistics = 0,
+        };
+
+        const VkCommandBufferBeginInfo command_buffer_begin_info = {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+            .pNext = nullptr,
+            .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT,
+            .pInheritanceInfo = &inheritance_info,
+        };
+
+        HE_VK_CHECK(vkBeginCommandBuffer(m_command_buffer, &command_buffer_begin_info));
+    }
 } // namespace hyper_engine
\ No newline at end of file
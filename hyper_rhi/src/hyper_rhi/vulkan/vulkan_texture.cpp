@@ -6,37 +6,25 @@
 
 #include "hyper_rhi/vulkan/vulkan_texture.hpp"
 
+#include <utility>
+
 #include <hyper_core/assertion.hpp>
 #include <hyper_core/logger.hpp>
 
 #include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
+#include "hyper_rhi/vulkan/vulkan_texture_heap.hpp"
 #include "hyper_rhi/vulkan/vulkan_texture_view.hpp"
 
 namespace hyper_engine
 {
-    RefPtr<Texture> VulkanGraphicsDevice::create_texture_platform(const TextureDescriptor &descriptor) const
-    {
-        return create_texture_internal(descriptor, VK_NULL_HANDLE);
-    }
-
-    RefPtr<Texture> VulkanGraphicsDevice::create_texture_internal(const TextureDescriptor &descriptor, const VkImage image) const
+    static VkImageCreateInfo image_create_info(const TextureDescriptor &descriptor)
     {
-        if (image != VK_NULL_HANDLE)
-        {
-            set_object_name(image, ObjectType::Image, descriptor.label);
-
-            return make_ref<VulkanTexture>(descriptor, image, VK_NULL_HANDLE);
-        }
-
-        const VkImageType image_type = VulkanTexture::get_image_type(descriptor.dimension);
-        const VkFormat format = VulkanTexture::get_format(descriptor.format);
-        const VkImageUsageFlags usage = VulkanTexture::get_image_usage_flags(descriptor.usage, descriptor.format);
-        const VkImageCreateInfo image_create_info = {
+        return {
             .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
             .pNext = nullptr,
             .flags = 0,
-            .imageType = image_type,
-            .format = format,
+            .imageType = VulkanTexture::get_image_type(descriptor.dimension),
+            .format = VulkanTexture::get_format(descriptor.format),
             .extent =
                 {
                     .width = descriptor.width,
@@ -47,18 +35,42 @@ namespace hyper_engine
             .arrayLayers = descriptor.array_size,
             .samples = VK_SAMPLE_COUNT_1_BIT,
             .tiling = VK_IMAGE_TILING_OPTIMAL,
-            .usage = usage,
+            .usage = VulkanTexture::get_image_usage_flags(descriptor.usage, descriptor.format),
             .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
             .queueFamilyIndexCount = 0,
             .pQueueFamilyIndices = nullptr,
             .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
         };
+    }
+
+    RefPtr<Texture> VulkanGraphicsDevice::create_texture_platform(const TextureDescriptor &descriptor) const
+    {
+        return create_texture_internal(descriptor, VK_NULL_HANDLE);
+    }
+
+    RefPtr<Texture> VulkanGraphicsDevice::create_texture_internal(const TextureDescriptor &descriptor, const VkImage image) const
+    {
+        if (image != VK_NULL_HANDLE)
+        {
+            set_object_name(image, ObjectType::Image, descriptor.label);
+
+            return make_ref<VulkanTexture>(descriptor, image, VK_NULL_HANDLE, nullptr);
+        }
+
+        const VkImageCreateInfo create_info = image_create_info(descriptor);
 
-        constexpr VmaAllocationCreateInfo allocation_create_info = {
+        // NOTE: Only tile based GPUs expose lazily allocated memory, everything else falls back to regular device memory
+        VkMemoryPropertyFlags preferred_flags = 0;
+        if (descriptor.usage & TextureUsage::Transient)
+        {
+            preferred_flags |= VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+        }
+
+        const VmaAllocationCreateInfo allocation_create_info = {
             .flags = 0,
             .usage = VMA_MEMORY_USAGE_AUTO,
             .requiredFlags = 0,
-            .preferredFlags = 0,
+            .preferredFlags = preferred_flags,
             .memoryTypeBits = 0,
             .pool = VK_NULL_HANDLE,
             .pUserData = nullptr,
@@ -67,27 +79,76 @@ namespace hyper_engine
 
         VkImage vk_image = VK_NULL_HANDLE;
         VmaAllocation allocation = VK_NULL_HANDLE;
-        HE_VK_CHECK(vmaCreateImage(m_allocator, &image_create_info, &allocation_create_info, &vk_image, &allocation, nullptr));
+        HE_VK_CHECK(vmaCreateImage(m_allocator, &create_info, &allocation_create_info, &vk_image, &allocation, nullptr));
 
         HE_ASSERT(vk_image != VK_NULL_HANDLE);
         HE_ASSERT(allocation != VK_NULL_HANDLE);
 
+        track_allocation(allocation, MemoryCategory::Texture);
+
         set_object_name(vk_image, ObjectType::Image, descriptor.label);
 
-        return make_ref<VulkanTexture>(descriptor, vk_image, allocation);
+        return make_ref<VulkanTexture>(descriptor, vk_image, allocation, nullptr);
+    }
+
+    RefPtr<Texture> VulkanGraphicsDevice::create_placed_texture_platform(
+        const TextureDescriptor &descriptor,
+        const RefPtr<TextureHeap> &heap,
+        const uint64_t offset) const
+    {
+        const VkImageCreateInfo create_info = image_create_info(descriptor);
+        const VulkanTextureHeap &vulkan_heap = static_cast<const VulkanTextureHeap &>(*heap);
+
+        VkImage image = VK_NULL_HANDLE;
+        HE_VK_CHECK(vmaCreateAliasingImage2(m_allocator, vulkan_heap.allocation(), offset, &create_info, &image));
+
+        HE_ASSERT(image != VK_NULL_HANDLE);
+
+        set_object_name(image, ObjectType::Image, descriptor.label);
+
+        return make_ref<VulkanTexture>(descriptor, image, VK_NULL_HANDLE, heap);
     }
 
-    VulkanTexture::VulkanTexture(const TextureDescriptor &descriptor, const VkImage image, const VmaAllocation allocation)
+    TextureMemoryRequirements VulkanGraphicsDevice::texture_memory_requirements_platform(const TextureDescriptor &descriptor) const
+    {
+        const VkImageCreateInfo create_info = image_create_info(descriptor);
+        const VkDeviceImageMemoryRequirements device_image_memory_requirements = {
+            .sType = VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS,
+            .pNext = nullptr,
+            .pCreateInfo = &create_info,
+            .planeAspect = VK_IMAGE_ASPECT_NONE,
+        };
+
+        VkMemoryRequirements2 memory_requirements = {
+            .sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2,
+            .pNext = nullptr,
+            .memoryRequirements = {},
+        };
+        vkGetDeviceImageMemoryRequirements(m_device, &device_image_memory_requirements, &memory_requirements);
+
+        return {
+            .byte_size = memory_requirements.memoryRequirements.size,
+            .alignment = memory_requirements.memoryRequirements.alignment,
+            .memory_type_bits = memory_requirements.memoryRequirements.memoryTypeBits,
+        };
+    }
+
+    VulkanTexture::VulkanTexture(
+        const TextureDescriptor &descriptor,
+        const VkImage image,
+        const VmaAllocation allocation,
+        RefPtr<TextureHeap> heap)
         : Texture(descriptor)
         , m_image(image)
         , m_allocation(allocation)
+        , m_heap(std::move(heap))
     {
     }
 
     VulkanTexture::~VulkanTexture()
     {
         VulkanGraphicsDevice *graphics_device = static_cast<VulkanGraphicsDevice *>(GraphicsDevice::get());
-        graphics_device->resource_queue().textures.emplace_back(m_image, m_allocation);
+        graphics_device->resource_queue().textures.emplace_back(m_image, m_allocation, m_heap != nullptr);
     }
 
     VkImage VulkanTexture::image() const
@@ -566,6 +627,13 @@ namespace hyper_engine
             }
         }
 
+        // NOTE: Transient attachments can't be used as anything else than attachments
+        if (texture_usage_flags & TextureUsage::Transient)
+        {
+            usage &= VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+            usage |= VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+        }
+
         return usage;
     }
 } // namespace hyper_engine
\ No newline at end of file
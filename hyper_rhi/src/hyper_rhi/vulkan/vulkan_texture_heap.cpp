@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2025-present, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/vulkan/vulkan_texture_heap.hpp"
+
+#include <hyper_core/assertion.hpp>
+
+#include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
+
+namespace hyper_engine
+{
+    RefPtr<TextureHeap> VulkanGraphicsDevice::create_texture_heap_platform(const TextureHeapDescriptor &descriptor) const
+    {
+        const VkMemoryRequirements memory_requirements = {
+            .size = descriptor.byte_size,
+            .alignment = descriptor.alignment,
+            .memoryTypeBits = descriptor.memory_type_bits,
+        };
+
+        // NOTE: Heaps are large and long lived, so they get their own device memory instead of a slice of a shared block
+        constexpr VmaAllocationCreateInfo allocation_create_info = {
+            .flags = VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT,
+            .usage = VMA_MEMORY_USAGE_UNKNOWN,
+            .requiredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+            .preferredFlags = 0,
+            .memoryTypeBits = 0,
+            .pool = VK_NULL_HANDLE,
+            .pUserData = nullptr,
+            .priority = 0,
+        };
+
+        VmaAllocation allocation = VK_NULL_HANDLE;
+        HE_VK_CHECK(vmaAllocateMemory(m_allocator, &memory_requirements, &allocation_create_info, &allocation, nullptr));
+
+        HE_ASSERT(allocation != VK_NULL_HANDLE);
+
+        track_allocation(allocation, MemoryCategory::Texture);
+
+        vmaSetAllocationName(m_allocator, allocation, descriptor.label.c_str());
+
+        return make_ref<VulkanTextureHeap>(descriptor, allocation);
+    }
+
+    VulkanTextureHeap::VulkanTextureHeap(const TextureHeapDescriptor &descriptor, const VmaAllocation allocation)
+        : TextureHeap(descriptor)
+        , m_allocation(allocation)
+    {
+    }
+
+    VulkanTextureHeap::~VulkanTextureHeap()
+    {
+        VulkanGraphicsDevice *graphics_device = static_cast<VulkanGraphicsDevice *>(GraphicsDevice::get());
+        graphics_device->resource_queue().texture_heaps.emplace_back(m_allocation);
+    }
+
+    VmaAllocation VulkanTextureHeap::allocation() const
+    {
+        return m_allocation;
+    }
+} // namespace hyper_engine
\ No newline at end of file